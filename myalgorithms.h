@@ -7,6 +7,23 @@
 #ifndef MYSTL_MYALGORITHMS_H
 #define MYSTL_MYALGORITHMS_H
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "myvector.h"
+#include "mysmallvector.h"
+#include "mydeque.h"
+
 ///Isolates MySTL Classes and functions names
 namespace mystl {
 
@@ -42,81 +59,960 @@ bool myequal (In first, In last, In2 first2) {
 }
 
 ///\brief Returns the position of the element in the first sequence where the second begins as a subsequence,
-///if doesn't exists returns the end of the first sequence
+///if doesn't exists returns the end of the first sequence.
+///It tries every position in O(n*m), a searcher object runs in linear time: see MyKmpSearcher and MyHorspoolSearcher
 template<class For, class For2>
 For mysearch(For first, For last, For2 first2, For2 last2) {
     while (first!=last) {
-        For tmp_it=first;//temporary iterator for the internal loop
-        while (tmp_it!=last && first2!=last2 && *tmp_it==*first2) {
+        For tmp_it=first;//temporary iterators for the internal loop
+        For2 tmp_it2=first2;
+        while (tmp_it!=last && tmp_it2!=last2 && *tmp_it==*tmp_it2) {
             ++tmp_it;
-            ++first2;
+            ++tmp_it2;
         }
-        if (first2==last2)
+        if (tmp_it2==last2)
             return first;//end of the second sequence
+        if (tmp_it==last)
+            return last;//the rest of the first sequence is shorter than the second
         ++first;
     }
     return first;
 }
 
+///\brief TRUE if two values of T can be ordered with operator<
+template<class T>
+class has_less {
+    template<class U>
+    static auto check(int) -> decltype(static_cast<bool>(std::declval<const U&>() < std::declval<const U&>()), std::true_type());
+    template<class U>
+    static std::false_type check(...);
+
+public:
+    static const bool value = decltype(check<T>(0))::value;
+};
+
+///\class MyKmpSearcher
+///\brief Searches a sequence preprocessed once in any number of sequences, in O(n) (Knuth, Morris and Pratt)
+///
+///The searched sequence is copied with its failure function: the length of the longest proper border of every
+///prefix. The text is read once with forward iterators, like the ones of MyList, and never read back.
+///A searcher is not modified by a search, so threads can share it
+template<class T>
+class MyKmpSearcher {
+private:
+    MyVector<T> _pattern;
+    ///_fail[q] is the length of the longest proper prefix of the first q+1 elements that is also their suffix
+    MyVector<std::size_t> _fail;
+
+public:
+    ///Preprocesses the sequence [first,last) in O(m)
+    template<class In>
+    MyKmpSearcher(In first, In last) {
+        for (; first!=last; ++first) {
+            _pattern.push_back(*first);
+        }
+        const std::size_t m=_pattern.size();
+        _fail.resize(m, 0);
+        std::size_t q=0;
+        for (std::size_t i=1; i<m; ++i) {
+            while (q>0 && !(_pattern[i]==_pattern[q])) {
+                q=_fail[q-1];
+            }
+            if (_pattern[i]==_pattern[q]) {
+                ++q;
+            }
+            _fail[i]=q;
+        }
+    }
+
+    ///Returnes the length of the searched sequence
+    std::size_t size() const {
+        return(_pattern.size());
+    }
+
+    ///Returnes the element n of the searched sequence
+    const T& operator[](std::size_t n) const {
+        return(_pattern[n]);
+    }
+
+    ///Returnes the position in [first,last) where the searched sequence begins, last if it does not occur
+    template<class For>
+    For operator()(For first, For last) const {
+        const std::size_t m=_pattern.size();
+        if (m==0) {
+            return(first);
+        }
+        //the matched prefix ends at the element read last, start follows the beginning of the window
+        For start=first;
+        std::size_t start_pos=0;
+        std::size_t pos=0;
+        std::size_t q=0;
+        for (; first!=last; ++first) {
+            while (q>0 && !(*first==_pattern[q])) {
+                q=_fail[q-1];
+            }
+            if (*first==_pattern[q]) {
+                ++q;
+            }
+            ++pos;
+            for (; start_pos<pos-q; ++start_pos) {
+                ++start;
+            }
+            if (q==m) {
+                return(start);
+            }
+        }
+        return(last);
+    }
+};
+
+///\class MyHorspoolSearcher
+///\brief Searches a sequence preprocessed once in random access sequences, skipping most of the text (Horspool)
+///
+///Each window of the text is checked from the element under the last one of the searched sequence, then the
+///window moves by the distance between that element and its last occurrence in the searched sequence: on texts
+///with a large alphabet most elements are never read. The distances are kept in a table for byte-sized integral
+///types and in a sorted vector for the types ordered by operator<.
+///Horspool alone is O(n*m) on periodic texts, so when the comparisons exceed twice the length of the text
+///the search goes on with a MyKmpSearcher: the worst case is linear.
+///A searcher is not modified by a search, so threads can share it
+template<class T>
+class MyHorspoolSearcher {
+    static_assert((std::is_integral<T>::value && sizeof(T)==1) || has_less<T>::value,
+        "MyHorspoolSearcher needs byte-sized or ordered elements, MyKmpSearcher only needs operator==");
+
+public:
+    ///TRUE if the distances are kept in a table
+    static const bool bytes = std::is_integral<T>::value && sizeof(T)==1;
+
+private:
+    MyVector<T> _pattern;
+    ///The distance from every element of the pattern but the last one to the end, for byte-sized types
+    MyVector<std::size_t> _table;
+    ///The elements of the pattern but the last one sorted with their distance, for ordered types
+    MyVector<std::pair<T,std::size_t> > _sorted;
+    MyKmpSearcher<T> _kmp;
+
+    ///Returnes how far the window moves when val is under the last element of the pattern
+    template<class U>
+    std::size_t shift(const U& val, std::true_type) const {
+        return(_table[static_cast<unsigned char>(val)]);
+    }
+
+    template<class U>
+    std::size_t shift(const U& val, std::false_type) const {
+        const std::pair<T,std::size_t>* first=_sorted.data();
+        const std::pair<T,std::size_t>* last=first+_sorted.size();
+        const std::pair<T,std::size_t>* found=std::lower_bound(first, last, val, [](const std::pair<T,std::size_t>& a, const U& b) {
+            return(a.first<b);
+        });
+        return(found==last || val<found->first ? _pattern.size() : found->second);
+    }
+
+    ///Fills the distances of the elements
+    void preprocess(std::true_type) {
+        const std::size_t m=_pattern.size();
+        _table.resize(256, m);
+        for (std::size_t i=0; i+1<m; ++i) {
+            _table[static_cast<unsigned char>(_pattern[i])]=m-1-i;
+        }
+    }
+
+    void preprocess(std::false_type) {
+        const std::size_t m=_pattern.size();
+        for (std::size_t i=0; i+1<m; ++i) {
+            _sorted.push_back(std::make_pair(_pattern[i], m-1-i));
+        }
+        //the last occurrence of every element comes first among its equals, then the others are dropped
+        std::sort(_sorted.data(), _sorted.data()+_sorted.size(), [](const std::pair<T,std::size_t>& a, const std::pair<T,std::size_t>& b) {
+            return(a.first<b.first || (!(b.first<a.first) && a.second<b.second));
+        });
+        MyVector<std::pair<T,std::size_t> > unique;
+        for (std::size_t k=0; k<_sorted.size(); ++k) {
+            if (k==0 || unique[unique.size()-1].first<_sorted[k].first) {
+                unique.push_back(_sorted[k]);
+            }
+        }
+        _sorted=unique;
+    }
+
+public:
+    ///Preprocesses the sequence [first,last) in O(m) for byte-sized types, O(m*log(m)) for the others
+    template<class In>
+    MyHorspoolSearcher(In first, In last) : _kmp(first, last) {
+        for (std::size_t i=0; i<_kmp.size(); ++i) {
+            _pattern.push_back(_kmp[i]);
+        }
+        preprocess(std::integral_constant<bool,bytes>());
+    }
+
+    ///Returnes the length of the searched sequence
+    std::size_t size() const {
+        return(_pattern.size());
+    }
+
+    ///Returnes the position in [first,last) where the searched sequence begins, last if it does not occur
+    template<class Ran>
+    Ran operator()(Ran first, Ran last) const {
+        const std::size_t m=_pattern.size();
+        if (m==0) {
+            return(first);
+        }
+        const std::size_t n=last-first;
+        if (n<m) {
+            return(last);
+        }
+        const T* p=_pattern.data();
+        std::size_t work=0;
+        for (std::size_t pos=0; pos<=n-m; ) {
+            const std::size_t k=m-1;
+            if (first[pos+k]==p[k]) {
+                std::size_t i=0;
+                while (i<k && first[pos+i]==p[i]) {
+                    ++i;
+                }
+                if (i==k) {
+                    return(first+pos);
+                }
+                work+=i;
+            }
+            work+=1;
+            if (work>2*n) {
+                //no match begins before pos: a linear search takes over
+                return(_kmp(first+pos, last));
+            }
+            pos+=shift(first[pos+k], std::integral_constant<bool,bytes>());
+        }
+        return(last);
+    }
+};
+
+///\brief Returnes the position of the element in [first,last) where the sequence preprocessed by searcher begins,
+///last if it does not occur. A searcher, like MyKmpSearcher or MyHorspoolSearcher, preprocesses the searched
+///sequence once for any number of searches
+template<class For, class Searcher>
+For mysearch(For first, For last, const Searcher& searcher) {
+    return(searcher(first, last));
+}
+
+///\class MyBitPattern
+///\brief The pattern of Myers' bit-parallel edit distance
+///
+///For every element of a text it gives the bitmask of the positions of the pattern holding an equal element,
+///one 64-bit word per block of 64 positions. Elements are told apart through a table for byte-sized integral
+///types and by binary search among the sorted distinct elements of the pattern for types ordered by operator<.
+///The masks of the elements occurring at least once per block are stored, the others are written on the fly
+///in a scratch row from the list of their positions: a lookup costs O(blocks) and the pattern O(length) memory,
+///whatever the size of the alphabet
+template<class T>
+class MyBitPattern {
+public:
+    ///TRUE if T is told apart through a table
+    static const bool bytes = std::is_integral<T>::value && sizeof(T)==1;
+
+private:
+    ///The number of elements
+    std::size_t _length;
+    ///The number of 64-bit words of a mask
+    std::size_t _blocks;
+    ///The distinct elements sorted, unused for byte-sized types
+    MyVector<T> _symbols;
+    ///For every symbol its row in _masks, or -1 if its mask is written on the fly
+    MyVector<int> _dense;
+    ///The stored masks
+    MyVector<uint64_t> _masks;
+    ///For every symbol the first of its entries in _positions, followed by the total
+    MyVector<std::size_t> _start;
+    ///The positions of the symbols whose mask is written on the fly, grouped by symbol
+    MyVector<std::size_t> _positions;
+    ///A row of zeros, except for the mask last lent
+    MyVector<uint64_t> _scratch;
+    ///The symbol whose mask is in _scratch, -1 if none
+    int _lent;
+    ///The positive and negative vertical deltas of the last run, kept so that the next ones do not allocate
+    MyVector<uint64_t> _pv;
+    MyVector<uint64_t> _mv;
+
+    template<class U, class In>
+    friend int myldist(MyBitPattern<U>& pattern, In first, In last);
+
+    ///Returnes the symbol of val, -1 if it is not in the pattern
+    int symbol(const T& val, std::true_type) const {
+        return(static_cast<unsigned char>(val));
+    }
+
+    int symbol(const T& val, std::false_type) const {
+        const T* first=_symbols.data();
+        const T* found=std::lower_bound(first, first+_symbols.size(), val);
+        return(found==first+_symbols.size() || val<*found ? -1 : static_cast<int>(found-first));
+    }
+
+    ///Numbers the elements of the pattern, returnes the number of symbols
+    std::size_t number(const MyVector<T>& pattern, MyVector<int>& ids, std::true_type) {
+        for (std::size_t i=0; i<_length; ++i) {
+            ids.push_back(static_cast<unsigned char>(pattern[i]));
+        }
+        return(256);
+    }
+
+    std::size_t number(const MyVector<T>& pattern, MyVector<int>& ids, std::false_type) {
+        MyVector<std::size_t> order(_length);
+        for (std::size_t i=0; i<_length; ++i) {
+            order.push_back(i);
+        }
+        std::sort(order.data(), order.data()+_length, [&pattern](std::size_t a, std::size_t b) {
+            return(pattern[a]<pattern[b]);
+        });
+        ids.resize(_length);
+        for (std::size_t i=0; i<_length; ++i) {
+            if (i==0 || _symbols[_symbols.size()-1]<pattern[order[i]]) {
+                _symbols.push_back(pattern[order[i]]);
+            }
+            ids[order[i]]=static_cast<int>(_symbols.size())-1;
+        }
+        return(_symbols.size());
+    }
+
+    ///Writes or clears the bits of a symbol in the scratch row
+    void scatter(int id, bool set) {
+        for (std::size_t k=_start[id]; k<_start[id+1]; ++k) {
+            const std::size_t p=_positions[k];
+            if (set) {
+                _scratch[p/64] |= static_cast<uint64_t>(1)<<(p%64);
+            } else {
+                _scratch[p/64] = 0;
+            }
+        }
+    }
+
+public:
+    ///Preprocesses the pattern [first,last) in O(length*log(length))
+    template<class For>
+    MyBitPattern(For first, For last) : _length(0), _blocks(0), _lent(-1) {
+        MyVector<T> pattern;
+        for (; first!=last; ++first) {
+            pattern.push_back(*first);
+        }
+        _length=pattern.size();
+        _blocks=(_length+63)/64;
+        MyVector<int> ids(_length);
+        const std::size_t symbols=number(pattern, ids, std::integral_constant<bool,bytes>());
+
+        MyVector<std::size_t> count;
+        count.resize(symbols, 0);
+        for (std::size_t i=0; i<_length; ++i) {
+            ++count[ids[i]];
+        }
+        //a symbol repeated at least once per block gets a stored mask: there are at most 64 of them
+        _dense.resize(symbols, -1);
+        int rows=0;
+        for (std::size_t id=0; id<symbols; ++id) {
+            if (count[id]>=_blocks && count[id]>0) {
+                _dense[id]=rows++;
+            }
+        }
+        _masks.resize(rows*_blocks, 0);
+        _start.resize(symbols+1, 0);
+        for (std::size_t id=0; id<symbols; ++id) {
+            _start[id+1]=_start[id] + (_dense[id]<0 ? count[id] : 0);
+        }
+        _positions.resize(_start[symbols], 0);
+        MyVector<std::size_t> next(_start.begin(), _start.end());
+        for (std::size_t i=0; i<_length; ++i) {
+            const int id=ids[i];
+            if (_dense[id]<0) {
+                _positions[next[id]++]=i;
+            } else {
+                _masks[_dense[id]*_blocks+i/64] |= static_cast<uint64_t>(1)<<(i%64);
+            }
+        }
+        _scratch.resize(_blocks, 0);
+        _pv.resize(_blocks, 0);
+        _mv.resize(_blocks, 0);
+    }
+
+    ///Returnes the number of elements of the pattern
+    std::size_t length() const {
+        return(_length);
+    }
+
+    ///Returnes the number of 64-bit words of a mask
+    std::size_t blocks() const {
+        return(_blocks);
+    }
+
+    ///Returnes the mask of the positions holding val, valid until the next call
+    const uint64_t* mask(const T& val) {
+        if (_lent>=0) {
+            scatter(_lent, false);
+            _lent=-1;
+        }
+        const int id=symbol(val, std::integral_constant<bool,bytes>());
+        if (id>=0 && _dense[id]>=0) {
+            return(_masks.data()+_dense[id]*_blocks);
+        }
+        if (id>=0) {
+            scatter(id, true);
+            _lent=id;
+        }
+        return(_scratch.data());
+    }
+};
+
+///\brief TRUE if myldist() compares sequences of T and T2 with Myers' algorithm: they hold the same type,
+///byte-sized or ordered by operator< and not floating point
+template<class T, class T2>
+class bit_parallel : public std::integral_constant<bool, std::is_same<T,T2>::value && (MyBitPattern<T>::bytes
+    || (has_less<T>::value && !std::is_floating_point<T>::value))> {};
+
+///\brief Advances a block of 64 rows of Myers' algorithm by one column.
+///pv and mv are the positive and negative vertical deltas, eq the mask of the column, hin the horizontal delta
+///entering the block from above; returnes the horizontal delta leaving the block at the row of the bit out
+inline int myldist_block(uint64_t& pv, uint64_t& mv, uint64_t eq, int hin, uint64_t out) {
+    const uint64_t hneg = hin<0 ? 1 : 0;
+    const uint64_t xv = eq | mv;
+    eq |= hneg;
+    const uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+    uint64_t ph = mv | ~(xh | pv);
+    uint64_t mh = pv & xh;
+    const int hout = (ph & out) ? 1 : ((mh & out) ? -1 : 0);
+    ph = (ph<<1) | (hin>0 ? 1 : 0);
+    mh = (mh<<1) | hneg;
+    pv = mh | ~(xv | ph);
+    mv = ph & xv;
+    return(hout);
+}
+
+///\brief Computes the Levenshtein distance between a preprocessed pattern and the text [first,last)
+///with Myers' bit-parallel algorithm in O(blocks*n), blocks being the length of the pattern divided by 64.
+///It works in the buffers of the pattern and allocates nothing: a thread matching many texts keeps its own pattern
+template<class T, class In>
+int myldist(MyBitPattern<T>& pattern, In first, In last) {
+    const std::size_t m=pattern.length();
+    if (m==0) {
+        return(mylength(first,last));
+    }
+    const std::size_t blocks=pattern.blocks();
+    const uint64_t high=static_cast<uint64_t>(1)<<63;
+    const uint64_t out=static_cast<uint64_t>(1)<<((m-1)%64);
+    //the distance between the whole pattern and the text read so far
+    int score=static_cast<int>(m);
+
+    if (blocks==1) {
+        uint64_t pv=~static_cast<uint64_t>(0);
+        uint64_t mv=0;
+        for (; first!=last; ++first) {
+            score+=myldist_block(pv, mv, pattern.mask(*first)[0], 1, out);
+        }
+        return(score);
+    }
+
+    MyVector<uint64_t>& pv=pattern._pv;
+    MyVector<uint64_t>& mv=pattern._mv;
+    for (std::size_t b=0; b<blocks; ++b) {
+        pv[b]=~static_cast<uint64_t>(0);
+        mv[b]=0;
+    }
+    for (; first!=last; ++first) {
+        const uint64_t* eq=pattern.mask(*first);
+        int h=1;
+        for (std::size_t b=0; b+1<blocks; ++b) {
+            h=myldist_block(pv[b], mv[b], eq[b], h, high);
+        }
+        score+=myldist_block(pv[blocks-1], mv[blocks-1], eq[blocks-1], h, out);
+    }
+    return(score);
+}
+
+///\brief myldist_rows() with the row along the first sequence, of n elements, the elements are still compared as *first==*first2
+template<class For, class For2, class Row>
+int myldist_rows_swapped(For first, For last, For2 first2, For2 last2, int n, Row& row) {
+    row.clear();
+    row.reserve(n+1);
+    for (int i = 0; i <= n; ++i) {
+        row.push_back(i);
+    }
+    for (int j = 1; first2!=last2 ; ++j, ++first2) {
+        int diag = row[0];
+        row[0] = j;
+        For tmp_it=first;
+        for (int i = 1; tmp_it!=last; ++i, ++tmp_it) {
+            const int cost = (*tmp_it == *first2) ? 0 : 1;
+            const int cell = std::min(row[i]+1, std::min(row[i-1]+1, diag+cost));
+            diag = row[i];
+            row[i] = cell;
+        }
+    }
+    return row[n];
+}
+
+///\brief Computes the Levenshtein distance with a single row of the dynamic programming matrix,
+///as long as the shorter sequence: it only needs operator== between the elements of the two sequences.
+///The row is kept in row, a MyVector or MySmallVector of int that can be reused by the next calls
+template<class For, class For2, class Row>
+int myldist_rows(For first, For last, For2 first2, For2 last2, Row& row) {
+    const int n = mylength(first,last);
+    const int m = mylength(first2,last2);
+    if (n == 0) {
+        return m;
+    }
+    if (m == 0) {
+        return n;
+    }
+    if (m > n) {
+        //the row runs along the first sequence, the shorter one
+        return(myldist_rows_swapped(first, last, first2, last2, n, row));
+    }
+
+    // Step 2: row[j] holds the distance between the prefix of the first sequence read so far
+    // and the first j elements of the second one
+    row.clear();
+    row.reserve(m+1);
+    for (int j = 0; j <= m; ++j) {
+        row.push_back(j);
+    }
+
+    // Step 3
+    for (int i = 1; first!=last ; ++i, ++first) {
+        // Step 4
+        int diag = row[0];
+        row[0] = i;
+        For2 tmp_it=first2;//temporary iterator for the internal loop
+        for (int j = 1; tmp_it!=last2; ++j, ++tmp_it) {
+            // Step 5
+            const int cost = (*first == *tmp_it) ? 0 : 1;
+
+            // Step 6
+            const int cell = std::min(row[j]+1, std::min(row[j-1]+1, diag+cost));
+            diag = row[j];
+            row[j] = cell;
+        }
+    }
+
+    // Step 7
+    return row[m];
+}
+
+///\brief myldist_rows() with a row of its own, short rows live inline
+template<class For, class For2>
+int myldist_rows(For first, For last, For2 first2, For2 last2) {
+    MySmallVector<int,16> row;
+    return(myldist_rows(first, last, first2, last2, row));
+}
+
+///\brief The sequences hold elements Myers' algorithm can tell apart: the shorter one becomes the pattern
+template<class For, class For2>
+int myldist(For first, For last, For2 first2, For2 last2, std::true_type) {
+    typedef typename std::decay<decltype(*first)>::type T;
+    const int n = mylength(first,last);
+    const int m = mylength(first2,last2);
+    if (m <= n) {
+        MyBitPattern<T> pattern(first2,last2);
+        return(myldist(pattern, first, last));
+    } else {
+        MyBitPattern<T> pattern(first,last);
+        return(myldist(pattern, first2, last2));
+    }
+}
+
+///\brief Any other sequences use the dynamic programming row
+template<class For, class For2>
+int myldist(For first, For last, For2 first2, For2 last2, std::false_type) {
+    return(myldist_rows(first, last, first2, last2));
+}
+
 ///\brief Compute the Levenshtein distance between two sequences
 ///
 ///The algorithms is explained at http://www.merriampark.com/ld.htm and is based on dynamic programming.
 ///The implementation is adapted from the one at http://www.merriampark.com/ldcpp.htm
 ///
+///When the two sequences hold the same type, byte-sized or ordered by operator< (and not floating point),
+///it runs Myers' bit-parallel algorithm ("A fast bit-vector algorithm for approximate string matching
+///based on dynamic programming", J.ACM 1999) extended to long patterns in blocks of 64 elements:
+///64 cells of the matrix are computed by a few word operations. The other sequences are compared with
+///operator== keeping a single row of the matrix. Either way the memory is O(min(n,m)).
+///
 ///It is a simplified version of the alignment algorithms I developed in my degree thesis
 ///which contributed to the bioinformatics project named ALiBio http://www.alibio.org/
 template<class For, class For2>
 int myldist(For first, For last, For2 first2, For2 last2) {
+    typedef typename std::decay<decltype(*first)>::type T;
+    typedef typename std::decay<decltype(*first2)>::type T2;
+    return(myldist(first, last, first2, last2, bit_parallel<T,T2>()));
+}
 
+///\brief Tells whether the Levenshtein distance between two sequences is at most k (k>=0):
+///returnes the distance if it is, k+1 otherwise
+///
+///Only the cells of the matrix within k of the diagonal can lead to a distance not above k (Ukkonen,
+///"Algorithms for approximate string matching", 1985): a band of 2k+1 cells per row is computed, in O(k)
+///memory and O(k*min(n,m)) time. The work stops as soon as every cell of a row is above k, since the
+///minimum of a row never decreases, and it is skipped entirely when the lengths differ by more than k.
+///A k above the longer length is lowered to it. band is the scratch holding the band, a vector of int
+///reused by the callers comparing many sequences
+template<class For, class For2, class Band>
+int myldist_bounded(For first, For last, For2 first2, For2 last2, int k, Band& band) {
     const int n = mylength(first,last);
     const int m = mylength(first2,last2);
-    if (n == 0) {
-        return m;
+    //the distance never exceeds the longer length, a larger threshold would only widen the band
+    k = std::min(k, std::max(n,m));
+    const int cap = k+1;
+    if (n-m > k || m-n > k) {
+        return(cap);
     }
-    if (m == 0) {
-        return n;
+
+    //band[d+1] holds the cell (i, i-k+d) of the current row, the cells out of the band and of the matrix are cap
+    band.clear();
+    band.resize(2*k+3, cap);
+    for (int j = 0; j <= k && j <= m; ++j) {
+        band[j+k+1] = j;
     }
 
-    typedef MyVector<MyVector<int> > Tmatrix;
+    For2 band_first=first2;//the element of the second sequence at the first column of the band
+    for (int i = 1; first!=last ; ++i, ++first) {
+        if (i-k > 1) {
+            ++band_first;
+        }
+        const int lo = std::max(1, i-k);
+        const int hi = std::min(m, i+k);
+        int row_min = cap;
+        if (i-k <= 0) {
+            band[k-i+1] = std::min(i, cap);
+            row_min = band[k-i+1];
+        }
+        For2 tmp_it=band_first;//temporary iterator for the internal loop
+        for (int j = lo; j <= hi; ++j, ++tmp_it) {
+            const int d = j-i+k;
+            const int cost = (*first == *tmp_it) ? 0 : 1;
+            const int cell = std::min(std::min(band[d+2]+1, band[d]+1), std::min(band[d+1]+cost, cap));
+            band[d+1] = cell;
+            row_min = std::min(row_min, cell);
+        }
+        //the columns beyond the end of the second sequence leave the band as cap
+        for (int d = hi-i+k+1; d <= 2*k; ++d) {
+            band[d+1] = cap;
+        }
+        if (row_min > k) {
+            return(cap);
+        }
+    }
+    return(band[m-n+k+1]);
+}
 
-    Tmatrix matrix(n+1);
+///\brief Tells whether the Levenshtein distance between two sequences is at most k (k>=0):
+///returnes the distance if it is, k+1 otherwise. The band is kept on the stack when k is small
+template<class For, class For2>
+int myldist_bounded(For first, For last, For2 first2, For2 last2, int k) {
+    MySmallVector<int,16> band;
+    return(myldist_bounded(first, last, first2, last2, k, band));
+}
 
-    // Size the vectors in the 2.nd dimension. Unfortunately C++ doesn't
-    // allow for allocation on declaration of 2.nd dimension of vec of vec
-    for (int i = 0; i <= n; ++i) {
-        matrix[i].reserve(m+1);
+///\class MyLdistMatcher
+///\brief The scratch of a thread comparing a query with many candidates
+///
+///With Myers' algorithm it holds the preprocessed query, otherwise the row of the dynamic programming matrix
+///and the band of the bounded one. Every thread copies a matcher built once, so the query is preprocessed once
+///and nothing is allocated per candidate once the buffers have grown to the longest one
+template<class For, class T2, bool Bits = bit_parallel<typename std::decay<decltype(*std::declval<For>())>::type, T2>::value>
+class MyLdistMatcher {
+private:
+    For _first;
+    For _last;
+    MyVector<int> _row;
+    MyVector<int> _band;
+
+public:
+    ///Creates a matcher for the query [first,last)
+    MyLdistMatcher(For first, For last) : _first(first), _last(last) {}
+
+    ///Returnes the distance between the query and [first2,last2), or bound+1 if it is above bound (when bound>=0)
+    template<class For2>
+    int operator()(For2 first2, For2 last2, int bound) {
+        if (bound<0) {
+            return(myldist_rows(_first, _last, first2, last2, _row));
+        }
+        return(myldist_bounded(_first, _last, first2, last2, bound, _band));
     }
+};
 
-    // Step 2
-    for (int i = 0; i <= n; ++i) {
-        matrix[i][0]=i;
+template<class For, class T2>
+class MyLdistMatcher<For,T2,true> {
+private:
+    MyBitPattern<T2> _pattern;
+
+public:
+    MyLdistMatcher(For first, For last) : _pattern(first,last) {}
+
+    template<class For2>
+    int operator()(For2 first2, For2 last2, int bound) {
+        if (bound>=0) {
+            //the lengths alone may exceed the bound
+            const int difference = mylength(first2,last2)-static_cast<int>(_pattern.length());
+            if (difference>bound || -difference>bound) {
+                return(bound+1);
+            }
+        }
+        const int d=myldist(_pattern, first2, last2);
+        return(bound>=0 && d>bound ? bound+1 : d);
     }
-    for (int j = 0; j <= m; ++j) {
-        matrix[0][j]=j;
+};
+
+///\brief Returnes the number of threads to run count tasks on: the requested ones, or the hardware ones if 0,
+///but no more than one for every chunk tasks
+inline unsigned int mythreads(unsigned int threads, std::size_t count, std::size_t chunk) {
+    if (threads==0) {
+        threads=std::thread::hardware_concurrency();
     }
+    const std::size_t chunks=(count+chunk-1)/chunk;
+    if (threads>chunks) {
+        threads=static_cast<unsigned int>(chunks);
+    }
+    return(threads==0 ? 1 : threads);
+}
 
-    // Step 3
-    for (int i = 1; (i <= n)&&(first!=last) ; ++i, ++first) {
-        // Step 4
-        For2 tmp_it=first2;//temporary iterator for the internal loop
-        for (int j = 1; (j <= m)&&(tmp_it!=last2); ++j, ++tmp_it) {
+///\class MyThreadPool
+///\brief A fixed set of threads running the jobs of myparallel_for(), created once and reused by every call
+///
+///A pool of size() threads holds size()-1 of them: the thread calling run() takes part in the job.
+///The threads sleep on a condition variable between two jobs, the calls to run() from different threads take turns
+class MyThreadPool {
+private:
+    MyDeque<std::thread> _threads;
+    std::mutex _run_mutex;//held for a whole job
+    std::mutex _mutex;//guards the members below
+    std::condition_variable _wake;
+    std::condition_variable _done;
+    const std::function<void(unsigned int)>* _job;
+    unsigned int _active;//the threads taking part in the current job
+    unsigned int _busy;//the pool threads still running it
+    std::size_t _generation;//counts the jobs, a thread wakes up when it changes
+    bool _stop;
 
-            // Step 5
-            int cost=0;
-            if (!(*first == *tmp_it))
-                cost = 1;
+    MyThreadPool(const MyThreadPool&);
+    MyThreadPool& operator=(const MyThreadPool&);
 
-            // Step 6
-            const int above = matrix[i-1][j];
-            const int left = matrix[i][j-1];
-            const int diag = matrix[i-1][j-1];
-            const int cell = std::min(above+1, std::min(left+1, diag+cost));
-            matrix[i][j]=cell;
+    ///The loop of the pool thread t: runs its part of every job until the pool is destroyed
+    void work(unsigned int t) {
+        std::size_t seen=0;
+        std::unique_lock<std::mutex> lock(_mutex);
+        for (;;) {
+            _wake.wait(lock, [&]() { return(_stop || _generation!=seen); });
+            if (_stop) {
+                return;
+            }
+            seen=_generation;
+            if (t<_active) {
+                const std::function<void(unsigned int)>& job=*_job;
+                lock.unlock();
+                job(t);
+                lock.lock();
+                if (--_busy==0) {
+                    _done.notify_one();
+                }
+            }
         }
     }
 
-    // Step 7
-    return matrix[n][m];
+    ///Stops and joins the pool threads
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop=true;
+        }
+        _wake.notify_all();
+        for (std::size_t t=0; t<_threads.size(); ++t) {
+            _threads[t].join();
+        }
+    }
+
+public:
+    ///Creates a pool of threads threads, the hardware ones if 0
+    explicit MyThreadPool(unsigned int threads=0) : _job(0), _active(0), _busy(0), _generation(0), _stop(false) {
+        if (threads==0) {
+            threads=std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        try {
+            //a deque builds the threads in place and never moves them
+            for (unsigned int t=1; t<threads; ++t) {
+                _threads.emplace_back(&MyThreadPool::work, this, t);
+            }
+        } catch (...) {
+            stop();
+            throw;
+        }
+    }
+
+    ///Stops the threads, it must not be running a job
+    ~MyThreadPool() {
+        stop();
+    }
+
+    ///Returnes the number of threads taking part in a job, the calling one included
+    unsigned int size() const {
+        return(static_cast<unsigned int>(_threads.size())+1);
+    }
+
+    ///Runs job(t) for every t in [0,threads) and waits for them: job(0) on the calling thread,
+    ///the others on the pool threads. threads must not exceed size() and job must not throw
+    void run(unsigned int threads, const std::function<void(unsigned int)>& job) {
+        if (threads==0) {
+            return;
+        }
+        std::lock_guard<std::mutex> run_lock(_run_mutex);
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _job=&job;
+            _active=threads;
+            _busy=threads-1;
+            ++_generation;
+        }
+        if (threads>1) {
+            _wake.notify_all();
+        }
+        job(0);
+        std::unique_lock<std::mutex> lock(_mutex);
+        _done.wait(lock, [&]() { return(_busy==0); });
+        _job=0;
+    }
+};
+
+///\brief Runs task(workers[t], i) for every i in [0,count) on one thread of pool for every worker, the first of them
+///being the calling thread. The threads take chunks of tasks from a shared counter, so that uneven tasks are balanced.
+///The first exception thrown by a task stops the others and is rethrown when every thread has finished.
+///There must be no more workers than pool.size()
+template<class Worker, class Task>
+void myparallel_for(MyThreadPool& pool, std::size_t count, MyVector<Worker>& workers, std::size_t chunk, Task task) {
+    std::atomic<std::size_t> next(0);
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    pool.run(static_cast<unsigned int>(workers.size()), [&](unsigned int t) {
+        try {
+            for (std::size_t first=next.fetch_add(chunk); first<count; first=next.fetch_add(chunk)) {
+                const std::size_t last = count-first<chunk ? count : first+chunk;
+                for (std::size_t i=first; i<last; ++i) {
+                    task(workers[t], i);
+                }
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) {
+                error=std::current_exception();
+            }
+            next.store(count);
+        }
+    });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+///\brief myparallel_for() on a pool created for this call only, with one thread for every worker
+template<class Worker, class Task>
+void myparallel_for(std::size_t count, MyVector<Worker>& workers, std::size_t chunk, Task task) {
+    MyThreadPool pool(static_cast<unsigned int>(workers.size()));
+    myparallel_for(pool, count, workers, chunk, task);
+}
+
+///The number of candidates a thread of myldist_batch() and myldist_nearest() takes at a time
+const std::size_t myldist_chunk=16;
+
+///\brief Computes the Levenshtein distance between the query [first,last) and every candidate in [cfirst,clast),
+///a random access range of sequences offering begin() and end(), like a MyVector<std::string>.
+///The distances are returned in the order of the candidates.
+///
+///The candidates are spread over the threads of pool, every thread working in its own copy of a MyLdistMatcher:
+///the query is preprocessed once and no matrix is allocated per candidate
+template<class For, class Ran>
+MyVector<int> myldist_batch(For first, For last, Ran cfirst, Ran clast, MyThreadPool& pool) {
+    typedef typename std::decay<decltype(*std::begin(*cfirst))>::type T2;
+    typedef MyLdistMatcher<For,T2> Matcher;
+    const std::size_t count=clast-cfirst;
+    const std::size_t chunk=myldist_chunk;
+
+    MyVector<int> distances;
+    distances.resize(count, 0);
+    const Matcher prototype(first,last);
+    MyVector<Matcher> workers;
+    for (unsigned int t=mythreads(pool.size(), count, chunk); t>0; --t) {
+        workers.push_back(prototype);
+    }
+    int* out=distances.data();
+    myparallel_for(pool, count, workers, chunk, [&](Matcher& matcher, std::size_t i) {
+        out[i]=matcher(std::begin(cfirst[i]), std::end(cfirst[i]), -1);
+    });
+    return(distances);
+}
+
+///\brief myldist_batch() on threads threads (the hardware ones if 0) created for this call only
+template<class For, class Ran>
+MyVector<int> myldist_batch(For first, For last, Ran cfirst, Ran clast, unsigned int threads=0) {
+    MyThreadPool pool(mythreads(threads, clast-cfirst, myldist_chunk));
+    return(myldist_batch(first, last, cfirst, clast, pool));
+}
+
+///\brief Finds the k candidates in [cfirst,clast) nearest to the query [first,last), see myldist_batch().
+///Returnes pairs of distance and index of the candidate, sorted by distance and then by index.
+///
+///Every thread keeps the k best candidates it has seen in a heap: a candidate is then only checked against the
+///worst of them, which skips the ones whose length is too far and bounds the dynamic programming to a band
+template<class For, class Ran>
+MyVector<std::pair<int,std::size_t> > myldist_nearest(For first, For last, Ran cfirst, Ran clast, std::size_t k, MyThreadPool& pool) {
+    typedef typename std::decay<decltype(*std::begin(*cfirst))>::type T2;
+    typedef MyLdistMatcher<For,T2> Matcher;
+    typedef std::pair<int,std::size_t> Hit;
+    //the scratch and the best candidates of a thread
+    struct Worker {
+        Matcher matcher;
+        MyVector<Hit> best;
+        Worker(const Matcher& m) : matcher(m) {}
+    };
+    const std::size_t count=clast-cfirst;
+    const std::size_t chunk=myldist_chunk;
+
+    MyVector<Hit> nearest;
+    if (k==0 || count==0) {
+        return(nearest);
+    }
+    const Matcher prototype(first,last);
+    MyVector<Worker> workers;
+    for (unsigned int t=mythreads(pool.size(), count, chunk); t>0; --t) {
+        workers.push_back(Worker(prototype));
+    }
+    myparallel_for(pool, count, workers, chunk, [&](Worker& worker, std::size_t i) {
+        MyVector<Hit>& best=worker.best;
+        const bool full = best.size()==k;
+        const int d=worker.matcher(std::begin(cfirst[i]), std::end(cfirst[i]), full ? best[0].first : -1);
+        const Hit hit(d,i);
+        if (!full) {
+            best.push_back(hit);
+            std::push_heap(best.begin(), best.end());
+        } else if (hit<best[0]) {
+            std::pop_heap(best.begin(), best.end());
+            best[k-1]=hit;
+            std::push_heap(best.begin(), best.end());
+        }
+    });
+
+    for (std::size_t t=0; t<workers.size(); ++t) {
+        for (std::size_t j=0; j<workers[t].best.size(); ++j) {
+            nearest.push_back(workers[t].best[j]);
+        }
+    }
+    std::sort(nearest.begin(), nearest.end());
+    while (nearest.size()>k) {
+        nearest.pop_back();
+    }
+    return(nearest);
+}
+
+///\brief myldist_nearest() on threads threads (the hardware ones if 0) created for this call only
+template<class For, class Ran>
+MyVector<std::pair<int,std::size_t> > myldist_nearest(For first, For last, Ran cfirst, Ran clast, std::size_t k, unsigned int threads=0) {
+    if (k==0 || clast==cfirst) {
+        return(MyVector<std::pair<int,std::size_t> >());
+    }
+    MyThreadPool pool(mythreads(threads, clast-cfirst, myldist_chunk));
+    return(myldist_nearest(first, last, cfirst, clast, k, pool));
 }
 
 }
@@ -0,0 +1,465 @@
+///\file myalignment.h
+///\brief The alignment of two sequences
+///
+///It contains the global (Needleman-Wunsch) and local (Smith-Waterman) alignment of two sequences with affine gap
+///penalties, computed in linear space with the divide and conquer of Hirschberg, and the score-only versions
+///walking the matrix by anti-diagonals.
+///An alignment maximizes the sum of the scores of the aligned pairs, given by a substitution functor, minus the
+///penalties of the gaps: a gap of k elements costs open+k*extend.
+///
+///It is a generic version of the alignment algorithms I developed in my degree thesis
+///which contributed to the bioinformatics project named ALiBio http://www.alibio.org/
+
+#ifndef MYSTL_MYALIGNMENT_H
+#define MYSTL_MYALIGNMENT_H
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+
+#include "myvector.h"
+
+#ifdef __GNUC__
+#define MYSTL_RESTRICT __restrict__
+#else
+#define MYSTL_RESTRICT
+#endif
+
+///Isolates MySTL Classes and functions names
+namespace mystl {
+
+///\class MyMatchScore
+///\brief The simplest substitution functor: equal elements score match, different ones mismatch
+class MyMatchScore {
+private:
+    int _match;
+    int _mismatch;
+
+public:
+    ///Creates a functor scoring match for equal elements and mismatch for different ones
+    MyMatchScore(int match=1, int mismatch=-1) : _match(match), _mismatch(mismatch) {}
+
+    ///Returnes the score of aligning a with b
+    template<class A, class B>
+    int operator()(const A& a, const B& b) const {
+        return(a==b ? _match : _mismatch);
+    }
+};
+
+///\class MyAlignment
+///\brief An alignment of the range [first,last) of a sequence with the range [first2,last2) of another one
+///
+///The edit script lists the columns of the alignment from left to right: a MATCH or a MISMATCH aligns the next
+///elements of both ranges, a DELETE aligns the next element of the first range with a gap and an INSERT aligns
+///a gap with the next element of the second range. The positions are offsets from the beginning of the sequences
+class MyAlignment {
+public:
+    ///The columns of an alignment
+    enum Op { MATCH, MISMATCH, DELETE, INSERT };
+
+    ///The score of the alignment
+    int score;
+    ///The aligned range of the first sequence
+    std::size_t first;
+    std::size_t last;
+    ///The aligned range of the second sequence
+    std::size_t first2;
+    std::size_t last2;
+    ///The edit script
+    MyVector<Op> script;
+
+    MyAlignment() : score(0), first(0), last(0), first2(0), last2(0) {}
+
+    ///Returnes the number of columns that are not a MATCH
+    std::size_t edits() const {
+        std::size_t n=0;
+        for (std::size_t k=0; k<script.size(); ++k) {
+            if (script[k]!=MATCH) {
+                ++n;
+            }
+        }
+        return(n);
+    }
+};
+
+///\class MyAligner
+///\brief Computes alignments of two random access sequences in linear space (Myers and Miller,
+///"Optimal alignments in linear space", 1988): the middle row of the first sequence is crossed at the column
+///where the forward and the reverse scores add up to the best, and the two halves are aligned recursively.
+///An alignment of n and m elements takes O(n*m) time and O(n+m) memory besides the script.
+///It is used by myalign_global() and myalign_local()
+template<class Ran, class Ran2, class Sub>
+class MyAligner {
+private:
+    Ran _a;
+    Ran2 _b;
+    Sub _sub;
+    int _open;
+    int _extend;
+    ///The best scores on the middle row, all and ending with a deletion, from the beginning (CC, DD) and from the end (RR, SS)
+    MyVector<int> _cc;
+    MyVector<int> _dd;
+    MyVector<int> _rr;
+    MyVector<int> _ss;
+    MyVector<MyAlignment::Op>* _script;
+
+    ///Returnes the penalty of a gap of k elements
+    int gap(std::size_t k) const {
+        return(k==0 ? 0 : _open+_extend*static_cast<int>(k));
+    }
+
+    ///Appends n columns of the kind op to the script
+    void emit(MyAlignment::Op op, std::size_t n) {
+        for (; n>0; --n) {
+            _script->push_back(op);
+        }
+    }
+
+    ///Appends the column aligning the elements i of the first sequence and j of the second
+    void emit_pair(std::size_t i, std::size_t j) {
+        _script->push_back(_a[i]==_b[j] ? MyAlignment::MATCH : MyAlignment::MISMATCH);
+    }
+
+    ///Computes in cc the best scores of the rows [a0,a1) aligned with the first j columns of [b0,b1), and in dd
+    ///the best ones ending with a deletion; Reverse walks both ranges from the end. A deletion at the start of
+    ///the rows opens for tg instead of the gap open penalty
+    template<bool Reverse>
+    void pass(std::size_t a0, std::size_t a1, std::size_t b0, std::size_t b1, int tg, MyVector<int>& cc, MyVector<int>& dd) {
+        const std::size_t m=a1-a0;
+        const std::size_t n=b1-b0;
+        int* c_row=cc.data();
+        int* d_row=dd.data();
+        c_row[0]=0;
+        int t=-_open;
+        for (std::size_t j=1; j<=n; ++j) {
+            t-=_extend;
+            c_row[j]=t;
+            d_row[j]=t-_open;
+        }
+        t=-tg;
+        for (std::size_t i=1; i<=m; ++i) {
+            const std::size_t ai = Reverse ? a1-i : a0+i-1;
+            int s=c_row[0];
+            t-=_extend;
+            int c=t;
+            c_row[0]=c;
+            int e=t-_open;
+            for (std::size_t j=1; j<=n; ++j) {
+                const std::size_t bj = Reverse ? b1-j : b0+j-1;
+                e=std::max(e, c-_open)-_extend;
+                d_row[j]=std::max(d_row[j], c_row[j]-_open)-_extend;
+                c=std::max(std::max(d_row[j], e), s+_sub(_a[ai], _b[bj]));
+                s=c_row[j];
+                c_row[j]=c;
+            }
+        }
+        d_row[0]=c_row[0];
+    }
+
+    ///Aligns the rows [a0,a1) with the columns [b0,b1); a deletion at the beginning opens for tb and one at the end for te
+    void diff(std::size_t a0, std::size_t a1, std::size_t b0, std::size_t b1, int tb, int te) {
+        const std::size_t m=a1-a0;
+        const std::size_t n=b1-b0;
+        if (n==0) {
+            emit(MyAlignment::DELETE, m);
+            return;
+        }
+        if (m==0) {
+            emit(MyAlignment::INSERT, n);
+            return;
+        }
+        if (m==1) {
+            //either the row is deleted, joining the cheaper boundary gap, or it is aligned with a column
+            int best=-(std::min(tb,te)+_extend)-gap(n);
+            std::size_t best_j=0;
+            for (std::size_t j=1; j<=n; ++j) {
+                const int score=-gap(j-1)+_sub(_a[a0], _b[b0+j-1])-gap(n-j);
+                if (score>best) {
+                    best=score;
+                    best_j=j;
+                }
+            }
+            if (best_j==0) {
+                if (tb<=te) {
+                    emit(MyAlignment::DELETE, 1);
+                    emit(MyAlignment::INSERT, n);
+                } else {
+                    emit(MyAlignment::INSERT, n);
+                    emit(MyAlignment::DELETE, 1);
+                }
+            } else {
+                emit(MyAlignment::INSERT, best_j-1);
+                emit_pair(a0, b0+best_j-1);
+                emit(MyAlignment::INSERT, n-best_j);
+            }
+            return;
+        }
+
+        const std::size_t mid=a0+m/2;
+        pass<false>(a0, mid, b0, b1, tb, _cc, _dd);
+        pass<true>(mid, a1, b0, b1, te, _rr, _ss);
+        //the middle row is crossed either between two columns (type 1) or inside a deletion (type 2)
+        int best=INT_MIN;
+        std::size_t best_j=0;
+        bool inside=false;
+        for (std::size_t j=0; j<=n; ++j) {
+            const int across=_cc[j]+_rr[n-j];
+            if (across>best) {
+                best=across;
+                best_j=j;
+                inside=false;
+            }
+            const int deletion=_dd[j]+_ss[n-j]+_open;
+            if (deletion>best) {
+                best=deletion;
+                best_j=j;
+                inside=true;
+            }
+        }
+        if (inside) {
+            diff(a0, mid-1, b0, b0+best_j, tb, 0);
+            emit(MyAlignment::DELETE, 2);
+            diff(mid+1, a1, b0+best_j, b1, 0, te);
+        } else {
+            diff(a0, mid, b0, b0+best_j, tb, _open);
+            diff(mid, a1, b0+best_j, b1, _open, te);
+        }
+    }
+
+public:
+    ///Creates an aligner of the sequences beginning at a and b, open and extend are the gap penalties
+    MyAligner(Ran a, Ran2 b, Sub sub, int open, int extend) : _a(a), _b(b), _sub(sub), _open(open), _extend(extend), _script(0) {}
+
+    ///Aligns globally the ranges [a0,a1) and [b0,b1) of the sequences, writing the script and the score in result
+    void align(std::size_t a0, std::size_t a1, std::size_t b0, std::size_t b1, MyAlignment& result) {
+        const std::size_t n=b1-b0+1;
+        _cc.resize(n, 0);
+        _dd.resize(n, 0);
+        _rr.resize(n, 0);
+        _ss.resize(n, 0);
+        result.first=a0;
+        result.last=a1;
+        result.first2=b0;
+        result.last2=b1;
+        result.script.clear();
+        _script=&result.script;
+        diff(a0, a1, b0, b1, _open, _open);
+        _script=0;
+        result.score=score(result);
+    }
+
+    ///Returnes the score of the script of an alignment
+    int score(const MyAlignment& alignment) const {
+        int total=0;
+        std::size_t i=alignment.first;
+        std::size_t j=alignment.first2;
+        for (std::size_t k=0; k<alignment.script.size(); ++k) {
+            const MyAlignment::Op op=alignment.script[k];
+            if (op==MyAlignment::DELETE || op==MyAlignment::INSERT) {
+                //a gap opens where the previous column is of another kind
+                if (k==0 || alignment.script[k-1]!=op) {
+                    total-=_open;
+                }
+                total-=_extend;
+                if (op==MyAlignment::DELETE) {
+                    ++i;
+                } else {
+                    ++j;
+                }
+            } else {
+                total+=_sub(_a[i], _b[j]);
+                ++i;
+                ++j;
+            }
+        }
+        return(total);
+    }
+
+    ///Finds the end of the best local alignment of [a0,a1) with [b0,b1) in linear space (Gotoh), returnes its score
+    ///and writes in end and end2 the positions after its last column
+    int local_end(std::size_t a0, std::size_t a1, std::size_t b0, std::size_t b1, std::size_t& end, std::size_t& end2) {
+        const std::size_t n=b1-b0;
+        const int ninf=INT_MIN/4;
+        _cc.resize(n+1, 0);
+        _dd.resize(n+1, 0);
+        int* h=_cc.data();
+        int* f=_dd.data();
+        for (std::size_t j=0; j<=n; ++j) {
+            h[j]=0;
+            f[j]=ninf;
+        }
+        int best=0;
+        end=a0;
+        end2=b0;
+        for (std::size_t i=a0; i<a1; ++i) {
+            int diag=0;
+            int e=ninf;
+            h[0]=0;
+            for (std::size_t j=1; j<=n; ++j) {
+                e=std::max(e, h[j-1]-_open)-_extend;
+                f[j]=std::max(f[j], h[j]-_open)-_extend;
+                const int cell=std::max(std::max(0, diag+_sub(_a[i], _b[b0+j-1])), std::max(e, f[j]));
+                diag=h[j];
+                h[j]=cell;
+                if (cell>best) {
+                    best=cell;
+                    end=i+1;
+                    end2=b0+j;
+                }
+            }
+        }
+        return(best);
+    }
+
+    ///Finds the start of a best alignment of [a0,end) with [b0,end2) ending at the two ends and scoring best, walking
+    ///both ranges backward from their ends; writes in start and start2 the positions of its first column
+    void local_start(std::size_t a0, std::size_t end, std::size_t b0, std::size_t end2, int best, std::size_t& start, std::size_t& start2) {
+        const std::size_t n=end2-b0;
+        const int ninf=INT_MIN/4;
+        int* h=_cc.data();
+        int* f=_dd.data();
+        h[0]=0;
+        f[0]=ninf;
+        for (std::size_t j=1; j<=n; ++j) {
+            h[j]=-gap(j);
+            f[j]=ninf;
+        }
+        start=end;
+        start2=end2;
+        for (std::size_t i=1; i<=end-a0; ++i) {
+            int diag=h[0];
+            h[0]=-gap(i);
+            int e=ninf;
+            for (std::size_t j=1; j<=n; ++j) {
+                e=std::max(e, h[j-1]-_open)-_extend;
+                f[j]=std::max(f[j], h[j]-_open)-_extend;
+                const int cell=std::max(diag+_sub(_a[end-i], _b[end2-j]), std::max(e, f[j]));
+                diag=h[j];
+                h[j]=cell;
+                if (cell==best) {
+                    start=end-i;
+                    start2=end2-j;
+                    return;
+                }
+            }
+        }
+    }
+};
+
+///\brief Aligns globally (Needleman-Wunsch) the random access sequences [first,last) and [first2,last2) with the
+///substitution functor sub and the gap penalties open and extend, in linear space (Hirschberg)
+template<class Ran, class Ran2, class Sub>
+MyAlignment myalign_global(Ran first, Ran last, Ran2 first2, Ran2 last2, Sub sub, int open, int extend) {
+    MyAligner<Ran,Ran2,Sub> aligner(first, first2, sub, open, extend);
+    MyAlignment result;
+    aligner.align(0, last-first, 0, last2-first2, result);
+    return(result);
+}
+
+///\brief Aligns locally (Smith-Waterman) the random access sequences [first,last) and [first2,last2): finds the
+///ranges whose global alignment scores the most. A forward pass finds where the best alignment ends, a backward
+///pass from there finds where it starts and the two ranges are aligned by myalign_global(), all in linear space.
+///If no pair of elements scores above zero the alignment is empty
+template<class Ran, class Ran2, class Sub>
+MyAlignment myalign_local(Ran first, Ran last, Ran2 first2, Ran2 last2, Sub sub, int open, int extend) {
+    MyAligner<Ran,Ran2,Sub> aligner(first, first2, sub, open, extend);
+    MyAlignment result;
+    std::size_t end=0;
+    std::size_t end2=0;
+    const int best=aligner.local_end(0, last-first, 0, last2-first2, end, end2);
+    if (best>0) {
+        std::size_t start=end;
+        std::size_t start2=end2;
+        aligner.local_start(0, end, 0, end2, best, start, start2);
+        aligner.align(start, end, start2, end2, result);
+    }
+    return(result);
+}
+
+///\brief Computes the rows [lo,hi] of an anti-diagonal of the score-only alignment from the two previous ones:
+///h the best scores, e and f the best ones ending with an insertion and a deletion. The cell of row i is in the column
+///d-i, it compares first[i-1] with first2[d-i-1]: only elements of the two sequences are ever reached.
+///The arrays never overlap, restrict lets the compiler vectorize the loop without checking it at run time
+template<bool Local, class Ran, class Ran2, class Sub>
+void myalign_diagonal(int* MYSTL_RESTRICT h0, int* MYSTL_RESTRICT e0, int* MYSTL_RESTRICT f0,
+                      const int* MYSTL_RESTRICT h1, const int* MYSTL_RESTRICT e1, const int* MYSTL_RESTRICT f1, const int* MYSTL_RESTRICT h2,
+                      Ran first, Ran2 first2, std::size_t d, std::size_t lo, std::size_t hi, Sub sub, int open, int extend) {
+    for (std::size_t i=lo; i<=hi; ++i) {
+        const int e=std::max(e1[i], h1[i]-open)-extend;
+        const int f=std::max(f1[i-1], h1[i-1]-open)-extend;
+        const int h=std::max(h2[i-1]+sub(first[i-1], first2[static_cast<std::ptrdiff_t>(d-1-i)]), std::max(e, f));
+        e0[i]=e;
+        f0[i]=f;
+        h0[i] = Local ? std::max(h, 0) : h;
+    }
+}
+
+///\brief Computes the score of the global (Local=false) or local (Local=true) alignment of two random access sequences.
+///The cells of an anti-diagonal of the matrix depend only on the two previous anti-diagonals, so the inner loop
+///has no dependency between its iterations and the compiler can vectorize it when the target has a vector
+///maximum of int (SSE4.1, AVX2 or NEON) and sub is inlined, like MyMatchScore. It takes O(n) memory
+template<bool Local, class Ran, class Ran2, class Sub>
+int myalign_diagonals(Ran first, Ran last, Ran2 first2, Ran2 last2, Sub sub, int open, int extend) {
+    const std::size_t n=last-first;
+    const std::size_t m=last2-first2;
+    const int ninf=INT_MIN/4;
+    //h2, h1 and h0 hold the anti-diagonals d-2, d-1 and d indexed by row, e and f the gaps ending with an insertion and a deletion
+    MyVector<int> rows[7];
+    for (int k=0; k<7; ++k) {
+        rows[k].resize(n+1, ninf);
+    }
+    int* h2=rows[0].data();
+    int* h1=rows[1].data();
+    int* h0=rows[2].data();
+    int* e1=rows[3].data();
+    int* e0=rows[4].data();
+    int* f1=rows[5].data();
+    int* f0=rows[6].data();
+    int best=0;
+    for (std::size_t d=0; d<=n+m; ++d) {
+        //the borders: row 0 and column 0
+        if (d<=m) {
+            h0[0] = Local || d==0 ? 0 : -(open+extend*static_cast<int>(d));
+            e0[0]=ninf;
+            f0[0]=ninf;
+        }
+        if (d<=n && d>0) {
+            h0[d] = Local ? 0 : -(open+extend*static_cast<int>(d));
+            e0[d]=ninf;
+            f0[d]=ninf;
+        }
+        //the inner cells, from row lo to row hi
+        if (d>=2) {
+            const std::size_t lo = d>m ? d-m : 1;
+            const std::size_t hi = std::min(n, d-1);
+            myalign_diagonal<Local>(h0, e0, f0, h1, e1, f1, h2, first, first2, d, lo, hi, sub, open, extend);
+            if (Local) {
+                for (std::size_t i=lo; i<=hi; ++i) {
+                    best=std::max(best, h0[i]);
+                }
+            }
+        }
+        int* t=h2;
+        h2=h1;
+        h1=h0;
+        h0=t;
+        std::swap(e1, e0);
+        std::swap(f1, f0);
+    }
+    return(Local ? best : h1[n]);
+}
+
+///\brief Computes the score of the global alignment of two random access sequences, see myalign_diagonals()
+template<class Ran, class Ran2, class Sub>
+int myalign_global_score(Ran first, Ran last, Ran2 first2, Ran2 last2, Sub sub, int open, int extend) {
+    return(myalign_diagonals<false>(first, last, first2, last2, sub, open, extend));
+}
+
+///\brief Computes the score of the local alignment of two random access sequences, see myalign_diagonals()
+template<class Ran, class Ran2, class Sub>
+int myalign_local_score(Ran first, Ran last, Ran2 first2, Ran2 last2, Sub sub, int open, int extend) {
+    return(myalign_diagonals<true>(first, last, first2, last2, sub, open, extend));
+}
+
+}
+#endif
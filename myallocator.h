@@ -0,0 +1,471 @@
+///\file myallocator.h
+///\brief The allocators used by the containers
+///
+///It contains the default allocator, a monotonic arena and a fixed-size pool together with the allocators drawing from them.
+///Every allocator follows the Standard allocator requirements so it can be passed to any MySTL container.
+
+#ifndef MYSTL_MYALLOCATOR_H
+#define MYSTL_MYALLOCATOR_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+///Isolates MySTL Classes and functions names
+namespace mystl {
+
+///\class MyAllocator
+///\brief The default allocator: it draws from the global heap through malloc and free
+///
+///Using the C heap lets it grow a buffer of trivially copyable elements with realloc,
+///which often extends the block in place instead of copying it
+template<class T>
+class MyAllocator {
+public:
+    typedef T value_type;
+
+    MyAllocator() {}
+    ///Converts from an allocator of another type (rebind)
+    template<class U>
+    MyAllocator(const MyAllocator<U>&) {}
+
+    ///Allocates uninitialized storage for n elements
+    T* allocate(std::size_t n) {
+        void* p = std::malloc(n*sizeof(T));
+        if (p==0) {
+            throw std::bad_alloc();
+        }
+        return(static_cast<T*>(p));
+    }
+
+    ///Releases storage obtained from allocate()
+    void deallocate(T* p, std::size_t) {
+        std::free(p);
+    }
+
+    ///Resizes storage obtained from allocate() from old_n to new_n elements, returnes its new address.
+    ///The content is moved bytewise, so it is only meant for trivially copyable T
+    T* reallocate(T* p, std::size_t, std::size_t new_n) {
+        void* q = std::realloc(p, new_n*sizeof(T));
+        if (q==0) {
+            throw std::bad_alloc();
+        }
+        return(static_cast<T*>(q));
+    }
+};
+
+///Operator ==: every default allocator can free the storage of the others
+template<class T, class U>
+bool operator==(const MyAllocator<T>&, const MyAllocator<U>&) {
+    return(true);
+}
+
+///Operator !=
+template<class T, class U>
+bool operator!=(const MyAllocator<T>&, const MyAllocator<U>&) {
+    return(false);
+}
+
+///\class MyAlignedAllocator
+///\brief An allocator returning storage aligned to Align bytes, drawn from the global heap
+///
+///Align is a power of two at least as large as alignof(T), like the 32 or 64 bytes of a SIMD register or of a cache line.
+///MyVector pads its capacity to a whole multiple of Align bytes when it uses this allocator.
+template<class T, std::size_t Align>
+class MyAlignedAllocator {
+    static_assert(Align>0 && (Align&(Align-1))==0, "MyAlignedAllocator needs a power of two alignment");
+    static_assert(Align>=alignof(T), "MyAlignedAllocator cannot align less than the type itself");
+
+public:
+    typedef T value_type;
+
+    ///The alignment of the storage
+    static const std::size_t alignment = Align;
+
+    ///The same allocator for another type, keeping at least its natural alignment
+    template<class U>
+    struct rebind {
+        typedef MyAlignedAllocator<U, (Align>alignof(U) ? Align : alignof(U))> other;
+    };
+
+    MyAlignedAllocator() {}
+    ///Converts from an allocator of another type (rebind)
+    template<class U, std::size_t A>
+    MyAlignedAllocator(const MyAlignedAllocator<U,A>&) {}
+
+    ///Allocates uninitialized storage for n elements starting at a multiple of Align.
+    ///The block is over-allocated and the address returned by malloc is kept just before the aligned storage
+    T* allocate(std::size_t n) {
+        void* raw = std::malloc(n*sizeof(T)+Align-1+sizeof(void*));
+        if (raw==0) {
+            throw std::bad_alloc();
+        }
+        const std::size_t aligned = (reinterpret_cast<std::size_t>(raw)+sizeof(void*)+Align-1) & ~(Align-1);
+        reinterpret_cast<void**>(aligned)[-1] = raw;
+        return(reinterpret_cast<T*>(aligned));
+    }
+
+    ///Releases storage obtained from allocate()
+    void deallocate(T* p, std::size_t) {
+        std::free(reinterpret_cast<void**>(p)[-1]);
+    }
+};
+
+///Operator ==: every aligned allocator can free the storage of the others
+template<class T, std::size_t A, class U, std::size_t B>
+bool operator==(const MyAlignedAllocator<T,A>&, const MyAlignedAllocator<U,B>&) {
+    return(true);
+}
+
+///Operator !=
+template<class T, std::size_t A, class U, std::size_t B>
+bool operator!=(const MyAlignedAllocator<T,A>&, const MyAlignedAllocator<U,B>&) {
+    return(false);
+}
+
+///\class MyArena
+///\brief A monotonic arena
+///
+///Memory is handed out from large blocks by bumping a pointer and is never given back one piece at a time:
+///everything is freed at once by release() or by the destructor.
+///It is not thread safe, a thread should use its own arena.
+class MyArena {
+private:
+    ///The header of every block, blocks are chained to be freed together
+    struct Block {
+        Block* next;
+    };
+
+    ///The most recent block
+    Block* _blocks;
+    ///The first free byte of the current block
+    char* _cur;
+    ///The end of the current block
+    char* _end;
+    ///The default size of a block
+    std::size_t _block_size;
+
+    MyArena(const MyArena&);
+    MyArena& operator=(const MyArena&);
+
+public:
+    ///Creates an empty arena, memory is requested in blocks of block_size bytes
+    explicit MyArena(std::size_t block_size=64*1024) : _blocks(0), _cur(0), _end(0), _block_size(block_size) {}
+
+    ///Deletes an arena releasing all its memory
+    ~MyArena() {
+        release();
+    }
+
+    ///Returnes bytes of storage aligned to align (a power of two)
+    void* allocate(std::size_t bytes, std::size_t align) {
+        std::size_t pad = (align - reinterpret_cast<std::size_t>(_cur) % align) % align;
+        if (_cur==0 || bytes+pad > static_cast<std::size_t>(_end-_cur)) {
+            //the header keeps the payload aligned for any fundamental type
+            const std::size_t header = (sizeof(Block)+alignof(std::max_align_t)-1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+            std::size_t size = header+bytes+align;
+            if (size<_block_size) {
+                size=_block_size;
+            }
+            Block* b = static_cast<Block*>(::operator new(size));
+            b->next=_blocks;
+            _blocks=b;
+            _cur=reinterpret_cast<char*>(b)+header;
+            _end=reinterpret_cast<char*>(b)+size;
+            pad = (align - reinterpret_cast<std::size_t>(_cur) % align) % align;
+        }
+        void* p = _cur+pad;
+        _cur+=pad+bytes;
+        return(p);
+    }
+
+    ///Grows or shrinks the storage at p from old_bytes to new_bytes without moving it.
+    ///It succeeds only if p is the most recent allocation and the current block has room, returnes FALSE otherwise
+    bool resize(void* p, std::size_t old_bytes, std::size_t new_bytes) {
+        char* last = static_cast<char*>(p)+old_bytes;
+        if (last!=_cur || (new_bytes>old_bytes && new_bytes-old_bytes > static_cast<std::size_t>(_end-_cur))) {
+            return(false);
+        }
+        _cur = static_cast<char*>(p)+new_bytes;
+        return(true);
+    }
+
+    ///Frees all the memory of the arena at once: everything allocated from it becomes invalid
+    void release() {
+        while (_blocks!=0) {
+            Block* next=_blocks->next;
+            ::operator delete(_blocks);
+            _blocks=next;
+        }
+        _cur=0;
+        _end=0;
+    }
+};
+
+///\class MyArenaAllocator
+///\brief An allocator drawing from a MyArena
+///
+///deallocate() does nothing, the memory comes back when the arena is released.
+///The arena must outlive every container using it.
+template<class T>
+class MyArenaAllocator {
+public:
+    typedef T value_type;
+
+    ///Creates an allocator drawing from arena
+    MyArenaAllocator(MyArena& arena) : _arena(&arena) {}
+    ///Converts from an allocator of another type (rebind)
+    template<class U>
+    MyArenaAllocator(const MyArenaAllocator<U>& other) : _arena(other.arena()) {}
+
+    ///Allocates uninitialized storage for n elements
+    T* allocate(std::size_t n) {
+        return(static_cast<T*>(_arena->allocate(n*sizeof(T), alignof(T))));
+    }
+
+    ///Does nothing: arena memory is freed all at once
+    void deallocate(T*, std::size_t) {}
+
+    ///Resizes storage obtained from allocate() from old_n to new_n elements, returnes its new address.
+    ///The storage is resized in place when it is the last one handed out by the arena,
+    ///otherwise the content is copied bytewise, so it is only meant for trivially copyable T
+    T* reallocate(T* p, std::size_t old_n, std::size_t new_n) {
+        if (_arena->resize(p, old_n*sizeof(T), new_n*sizeof(T))) {
+            return(p);
+        }
+        T* q = allocate(new_n);
+        std::memcpy(static_cast<void*>(q), static_cast<const void*>(p), (old_n<new_n ? old_n : new_n)*sizeof(T));
+        return(q);
+    }
+
+    ///Returnes the arena used by the allocator
+    MyArena* arena() const {
+        return(_arena);
+    }
+
+private:
+    MyArena* _arena;
+};
+
+///Operator ==: allocators are interchangeable when they share the arena
+template<class T, class U>
+bool operator==(const MyArenaAllocator<T>& a, const MyArenaAllocator<U>& b) {
+    return(a.arena()==b.arena());
+}
+
+///Operator !=
+template<class T, class U>
+bool operator!=(const MyArenaAllocator<T>& a, const MyArenaAllocator<U>& b) {
+    return(a.arena()!=b.arena());
+}
+
+///\class MyPool
+///\brief A pool of fixed-size chunks
+///
+///Chunks are carved out of blocks and recycled through a free list, so allocation and deallocation are O(1)
+///and never reach the global heap once the pool is warm. The blocks are freed by the destructor.
+///The chunk size can be given to the constructor or left to the first allocation,
+///which is handy when the pool serves an allocator rebound to a type the user cannot name.
+///It is not thread safe, a thread should use its own pool.
+class MyPool {
+private:
+    ///A free chunk, linked in the free list
+    struct Chunk {
+        Chunk* next;
+    };
+
+    ///The size of a chunk, 0 until it is known
+    std::size_t _chunk_size;
+    ///The number of chunks carved from each block
+    std::size_t _chunks_per_block;
+    ///The free list
+    Chunk* _free;
+    ///The blocks, chained through their first chunk-sized slot
+    Chunk* _blocks;
+
+    MyPool(const MyPool&);
+    MyPool& operator=(const MyPool&);
+
+    ///Allocates a new block and adds its chunks to the free list
+    void grow() {
+        char* block = static_cast<char*>(::operator new((_chunks_per_block+1)*_chunk_size));
+        Chunk* header = reinterpret_cast<Chunk*>(block);
+        header->next=_blocks;
+        _blocks=header;
+        for (std::size_t i=_chunks_per_block; i>0; --i) {
+            Chunk* c = reinterpret_cast<Chunk*>(block+i*_chunk_size);
+            c->next=_free;
+            _free=c;
+        }
+    }
+
+public:
+    ///Creates an empty pool of chunks of chunk_size bytes (0: decided by the first allocation)
+    explicit MyPool(std::size_t chunk_size=0, std::size_t chunks_per_block=256) : _chunk_size(0), _chunks_per_block(chunks_per_block>0 ? chunks_per_block : 1), _free(0), _blocks(0) {
+        if (chunk_size>0) {
+            set_chunk_size(chunk_size);
+        }
+    }
+
+    ///Deletes a pool releasing all its blocks
+    ~MyPool() {
+        while (_blocks!=0) {
+            Chunk* next=_blocks->next;
+            ::operator delete(_blocks);
+            _blocks=next;
+        }
+    }
+
+    ///Returnes the size of a chunk (0 if not yet decided)
+    std::size_t chunk_size() const {
+        return(_chunk_size);
+    }
+
+    ///Fixes the size of the chunks, rounded up to keep them aligned for any fundamental type
+    void set_chunk_size(std::size_t bytes) {
+        if (_chunk_size==0) {
+            if (bytes<sizeof(Chunk)) {
+                bytes=sizeof(Chunk);
+            }
+            _chunk_size = (bytes+alignof(std::max_align_t)-1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+        }
+    }
+
+    ///Returnes a chunk
+    void* allocate() {
+        if (_free==0) {
+            grow();
+        }
+        Chunk* c=_free;
+        _free=c->next;
+        return(c);
+    }
+
+    ///Gives a chunk back to the pool
+    void deallocate(void* p) {
+        Chunk* c=static_cast<Chunk*>(p);
+        c->next=_free;
+        _free=c;
+    }
+};
+
+///\class MyPoolAllocator
+///\brief An allocator drawing single objects from a MyPool
+///
+///Requests for one object that fits a chunk come from the pool,
+///larger ones (like the buffer of a vector) fall back to the global heap.
+///The pool must outlive every container using it.
+template<class T>
+class MyPoolAllocator {
+public:
+    typedef T value_type;
+
+    ///Creates an allocator drawing from pool
+    MyPoolAllocator(MyPool& pool) : _pool(&pool) {}
+    ///Converts from an allocator of another type (rebind)
+    template<class U>
+    MyPoolAllocator(const MyPoolAllocator<U>& other) : _pool(other.pool()) {}
+
+    ///Allocates uninitialized storage for n elements
+    T* allocate(std::size_t n) {
+        if (n==1 && alignof(T)<=alignof(std::max_align_t)) {
+            _pool->set_chunk_size(sizeof(T));
+            if (sizeof(T)<=_pool->chunk_size()) {
+                return(static_cast<T*>(_pool->allocate()));
+            }
+        }
+        return(static_cast<T*>(::operator new(n*sizeof(T))));
+    }
+
+    ///Releases storage obtained from allocate()
+    void deallocate(T* p, std::size_t n) {
+        if (n==1 && alignof(T)<=alignof(std::max_align_t) && sizeof(T)<=_pool->chunk_size()) {
+            _pool->deallocate(p);
+        } else {
+            ::operator delete(p);
+        }
+    }
+
+    ///Returnes the pool used by the allocator
+    MyPool* pool() const {
+        return(_pool);
+    }
+
+private:
+    MyPool* _pool;
+};
+
+///Operator ==: allocators are interchangeable when they share the pool
+template<class T, class U>
+bool operator==(const MyPoolAllocator<T>& a, const MyPoolAllocator<U>& b) {
+    return(a.pool()==b.pool());
+}
+
+///Operator !=
+template<class T, class U>
+bool operator!=(const MyPoolAllocator<T>& a, const MyPoolAllocator<U>& b) {
+    return(a.pool()!=b.pool());
+}
+
+///\class has_reallocate
+///\brief Tells whether an allocator can resize a buffer of trivially copyable elements through a reallocate(p,old_n,new_n) method
+template<class Alloc>
+class has_reallocate {
+    template<class A>
+    static char test(decltype(&A::reallocate));
+    template<class A>
+    static long test(...);
+
+public:
+    static const bool value = sizeof(test<Alloc>(0))==1;
+};
+
+///\class allocator_always_equal
+///\brief Tells whether every allocator of a type can free the storage of the others: its is_always_equal member
+///if it has one, otherwise TRUE for stateless allocators such as MyAllocator and MyAlignedAllocator
+template<class Alloc>
+class allocator_always_equal {
+    template<class A>
+    static char test(typename A::is_always_equal*);
+    template<class A>
+    static long test(...);
+
+    template<class A, bool>
+    struct pick {
+        static const bool value = std::is_empty<A>::value;
+    };
+    template<class A>
+    struct pick<A,true> {
+        static const bool value = A::is_always_equal::value;
+    };
+
+public:
+    static const bool value = pick<Alloc, sizeof(test<Alloc>(0))==1>::value;
+};
+
+///\class allocator_alignment
+///\brief The alignment an allocator guarantees: its alignment member if it has one, the one of its value_type otherwise
+template<class Alloc>
+class allocator_alignment {
+    template<class A>
+    static char test(decltype(&A::alignment));
+    template<class A>
+    static long test(...);
+
+    template<class A, bool>
+    struct pick {
+        static const std::size_t value = alignof(typename A::value_type);
+    };
+    template<class A>
+    struct pick<A,true> {
+        static const std::size_t value = A::alignment;
+    };
+
+public:
+    static const std::size_t value = pick<Alloc, sizeof(test<Alloc>(0))==1>::value;
+};
+
+}
+#endif
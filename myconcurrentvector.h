@@ -0,0 +1,518 @@
+///\file myconcurrentvector.h
+///\brief The concurrent vector container
+///
+///It contains implementation of a vector that many threads can grow at the same time without locks, with the relative iterators
+
+#ifndef MYSTL_MYCONCURRENTVECTOR_H
+#define MYSTL_MYCONCURRENTVECTOR_H
+
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "myallocator.h"
+
+///Isolates MySTL Classes and functions names
+namespace mystl {
+
+///\class MyConcurrentVector
+///\brief A vector that grows concurrently and never moves its elements
+///
+///The elements live in segments of doubling size: segment k holds 16*2^k elements and is allocated by
+///the first thread that needs it, so growing never relocates anything and the address of an element,
+///as well as any iterator to it, stays valid until the vector is cleared or deleted.
+///
+///push_back(), emplace_back() and grow_by() are lock-free: a thread claims its slots with an atomic
+///increment of the size, once the segments holding them are allocated, and then constructs them without
+///waiting for the others. Every slot has a flag telling whether its element is ready; size() returns the
+///length of the prefix of finished slots, so a reader can safely access every element below a size it
+///observed while the writers go on appending.
+///A failed append claims nothing when it can: a failed allocation happens before the claim, and an element
+///whose constructor may throw is built before the claim and then moved in, if its move cannot throw.
+///Otherwise the slot of an element whose constructor threw becomes a hole: it is counted by size() like the
+///others, so the elements after it stay visible, but it holds no element. Iterators skip the holes,
+///is_hole() tells them apart for operator[].
+///
+///The allocator is called by several threads at the same time: it must be thread safe, as MyAllocator is.
+///clear(), the destructor and the assignment of elements are not synchronized.
+///It contains an inner class template, basic_iterator, instantiated as iterator and const_iterator
+template<class T, class Alloc = MyAllocator<T> >
+class MyConcurrentVector {
+
+private:
+    ///The ready flag of a slot
+    typedef std::atomic<unsigned char> Flag;
+
+    ///The states of a slot
+    enum { EMPTY = 0, READY = 1, BROKEN = 2 };
+
+    ///The first segment holds 2^first_bits elements
+    static const std::size_t first_bits = 4;
+    ///Enough segments to address every size_t index
+    static const std::size_t max_segments = sizeof(std::size_t)*CHAR_BIT - first_bits;
+
+    ///The segments, 0 until allocated; the ready flags of segment k follow its elements
+    std::atomic<T*> _segments[max_segments];
+    ///The number of claimed slots
+    std::atomic<std::size_t> _claimed;
+    ///A prefix of slots known to be ready, advanced by size()
+    mutable std::atomic<std::size_t> _published;
+    ///The allocator providing the segments
+    Alloc _alloc;
+
+    MyConcurrentVector(const MyConcurrentVector&);
+    MyConcurrentVector& operator=(const MyConcurrentVector&);
+
+    ///Returnes the floor of the base 2 logarithm of x (x>0)
+    static std::size_t log2(std::size_t x) {
+#ifdef __GNUC__
+        return(sizeof(unsigned long long)*CHAR_BIT-1-__builtin_clzll(x));
+#else
+        std::size_t r=0;
+        while (x>>=1) {
+            ++r;
+        }
+        return(r);
+#endif
+    }
+
+    ///Returnes the segment holding the element at index i
+    static std::size_t segment_of(std::size_t i) {
+        return(log2((i>>first_bits)+1));
+    }
+
+    ///Returnes the index of the first element of segment k
+    static std::size_t segment_base(std::size_t k) {
+        return((static_cast<std::size_t>(1)<<first_bits<<k) - (static_cast<std::size_t>(1)<<first_bits));
+    }
+
+    ///Returnes the number of elements of segment k
+    static std::size_t segment_size(std::size_t k) {
+        return(static_cast<std::size_t>(1)<<first_bits<<k);
+    }
+
+    ///Returnes the number of T allocated for a segment of n elements and their flags
+    static std::size_t segment_storage(std::size_t n) {
+        return(n + (n*sizeof(Flag)+sizeof(T)-1)/sizeof(T));
+    }
+
+    ///Returnes the ready flags of segment k
+    static Flag* flags(T* segment, std::size_t k) {
+        return(reinterpret_cast<Flag*>(segment+segment_size(k)));
+    }
+
+    ///Returnes segment k allocating it if needed, concurrent callers agree on a single allocation
+    T* ensure_segment(std::size_t k) {
+        T* segment=_segments[k].load(std::memory_order_acquire);
+        if (segment==0) {
+            const std::size_t n=segment_size(k);
+            T* fresh=_alloc.allocate(segment_storage(n));
+            Flag* f=flags(fresh,k);
+            for (std::size_t i=0; i<n; ++i) {
+                new (f+i) Flag(EMPTY);
+            }
+            if (_segments[k].compare_exchange_strong(segment, fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                segment=fresh;
+            } else {
+                //another thread was faster, segment now holds its allocation
+                _alloc.deallocate(fresh, segment_storage(n));
+            }
+        }
+        return(segment);
+    }
+
+    ///Returnes the state of the slot at index i
+    unsigned char state(std::size_t i) const {
+        const std::size_t k=segment_of(i);
+        T* segment=_segments[k].load(std::memory_order_acquire);
+        return(segment==0 ? static_cast<unsigned char>(EMPTY) : flags(segment,k)[i-segment_base(k)].load(std::memory_order_acquire));
+    }
+
+    ///Marks the slots in [first,last) as holes after a failed construction, their segments are allocated
+    void break_slots(std::size_t first, std::size_t last) {
+        for (; first!=last; ++first) {
+            const std::size_t k=segment_of(first);
+            flags(_segments[k].load(std::memory_order_acquire),k)[first-segment_base(k)].store(BROKEN, std::memory_order_release);
+        }
+    }
+
+    ///Claims n slots after allocating the segments holding them, returnes the first index.
+    ///A failed allocation throws before anything is claimed
+    std::size_t claim(std::size_t n) {
+        std::size_t first=_claimed.load(std::memory_order_relaxed);
+        do {
+            if (n>std::numeric_limits<std::size_t>::max()-first) {
+                throw std::length_error("Vector too long");
+            }
+            if (n>0) {
+                for (std::size_t k=segment_of(first); k<=segment_of(first+n-1); ++k) {
+                    ensure_segment(k);
+                }
+            }
+        } while (!_claimed.compare_exchange_weak(first, first+n, std::memory_order_relaxed, std::memory_order_relaxed));
+        return(first);
+    }
+
+    ///Claims n slots and constructs them in place forwarding args to the constructor of every element,
+    ///returnes the first index. The slots whose construction threw become holes
+    template<class... Args>
+    std::size_t append(std::size_t n, Args&&... args) {
+        const std::size_t first=claim(n);
+        std::size_t i=first;
+        try {
+            for (; i<first+n; ++i) {
+                const std::size_t k=segment_of(i);
+                T* segment=_segments[k].load(std::memory_order_acquire);
+                const std::size_t offset=i-segment_base(k);
+                new (segment+offset) T(std::forward<Args>(args)...);
+                flags(segment,k)[offset].store(READY, std::memory_order_release);
+            }
+        } catch (...) {
+            break_slots(i, first+n);
+            throw;
+        }
+        return(first);
+    }
+
+    ///Appends an element built from args: in place if that cannot throw, otherwise it is built before
+    ///claiming its slot and then moved in, so a throwing constructor leaves no hole
+    template<class... Args>
+    std::size_t append_one(std::true_type, Args&&... args) {
+        return(append(1, std::forward<Args>(args)...));
+    }
+
+    template<class... Args>
+    std::size_t append_one(std::false_type, Args&&... args) {
+        T val(std::forward<Args>(args)...);
+        return(append(1, std::move(val)));
+    }
+
+    ///Returnes the index of the first slot that is not a hole
+    std::size_t first_element() const {
+        std::size_t i=0;
+        while (is_hole(i)) {
+            ++i;
+        }
+        return(i);
+    }
+
+    ///Destroys the ready elements, the segments are kept
+    void destroy() {
+        const std::size_t claimed=_claimed.load(std::memory_order_acquire);
+        for (std::size_t i=0; i<claimed; ++i) {
+            const std::size_t k=segment_of(i);
+            T* segment=_segments[k].load(std::memory_order_relaxed);
+            if (segment!=0) {
+                Flag& f=flags(segment,k)[i-segment_base(k)];
+                if (f.load(std::memory_order_relaxed)==READY) {
+                    segment[i-segment_base(k)].~T();
+                }
+                f.store(EMPTY, std::memory_order_relaxed);
+            }
+        }
+    }
+
+public:
+    ///Creates an empty vector, no storage is allocated until the first element is inserted
+    MyConcurrentVector(const Alloc& alloc=Alloc()) : _claimed(0), _published(0), _alloc(alloc) {
+        for (std::size_t k=0; k<max_segments; ++k) {
+            _segments[k].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    ///Deletes a vector with its elements, no other thread may be using it
+    ~MyConcurrentVector() {
+        destroy();
+        for (std::size_t k=0; k<max_segments; ++k) {
+            T* segment=_segments[k].load(std::memory_order_relaxed);
+            if (segment!=0) {
+                _alloc.deallocate(segment, segment_storage(segment_size(k)));
+            }
+        }
+    }
+
+    ///Operator []: i must be below a size() observed by the calling thread and not be a hole
+    T& operator[](std::size_t i) {
+        const std::size_t k=segment_of(i);
+        return(_segments[k].load(std::memory_order_acquire)[i-segment_base(k)]);
+    }
+
+    ///Operator [] on a constant vector
+    const T& operator[](std::size_t i) const {
+        const std::size_t k=segment_of(i);
+        return(_segments[k].load(std::memory_order_acquire)[i-segment_base(k)]);
+    }
+
+    ///Returnes TRUE if no element is ready
+    bool empty() const {
+        return(size()==0);
+    }
+
+    ///Returnes the number of slots finished, holes included: the ones claimed later by other threads,
+    ///or still under construction, are not counted. Every element below the returned size can be accessed
+    std::size_t size() const {
+        std::size_t n=_published.load(std::memory_order_acquire);
+        const std::size_t claimed=_claimed.load(std::memory_order_relaxed);
+        while (n<claimed && state(n)!=EMPTY) {
+            ++n;
+        }
+        //share the progress with the next callers
+        std::size_t cur=_published.load(std::memory_order_relaxed);
+        while (cur<n && !_published.compare_exchange_weak(cur, n, std::memory_order_release, std::memory_order_relaxed)) {}
+        return(n);
+    }
+
+    ///Returnes TRUE if the slot i, below a size() observed by the calling thread, is a hole left by a failed construction
+    bool is_hole(std::size_t i) const {
+        return(state(i)==BROKEN);
+    }
+
+    ///Returnes the allocator
+    Alloc get_allocator() const {
+        return(_alloc);
+    }
+
+    ///Allocates the segments needed to hold n elements, so that growing up to n elements does not allocate
+    void reserve(std::size_t n) {
+        if (n>0) {
+            const std::size_t last=segment_of(n-1);
+            for (std::size_t k=0; k<=last; ++k) {
+                ensure_segment(k);
+            }
+        }
+    }
+
+    ///Deletes the content of the vector keeping its segments, no other thread may be using it
+    void clear() {
+        destroy();
+        _claimed.store(0, std::memory_order_relaxed);
+        _published.store(0, std::memory_order_relaxed);
+    }
+
+    ///\class basic_iterator
+    ///\brief A bidirectional iterator for MyConcurrentVector
+    ///
+    ///iterator (U=T) and const_iterator (U=const T) are its two instances, an iterator converts to a const_iterator.
+    ///It keeps an index, so it stays valid while the vector grows.
+    ///Increments skip the holes, and two iterators separated only by holes compare equal, so a walk
+    ///stops at an end() taken before a hole appeared right there. The offsets (+, -, []) count slots, holes included
+    template<class U>
+    class basic_iterator {
+    private:
+        typedef typename std::conditional<std::is_const<U>::value, const MyConcurrentVector, MyConcurrentVector>::type Vector;
+        Vector* vec;
+        std::size_t index;
+
+        ///Returnes TRUE if every slot between a and b is a hole
+        static bool equivalent(const basic_iterator& a, const basic_iterator& b) {
+            std::size_t lo = a.index<b.index ? a.index : b.index;
+            const std::size_t hi = a.index<b.index ? b.index : a.index;
+            while (lo<hi && a.vec->is_hole(lo)) {
+                ++lo;
+            }
+            return(lo==hi);
+        }
+
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef typename std::remove_const<U>::type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef U* pointer;
+        typedef U& reference;
+
+        basic_iterator() : vec(0), index(0) {}
+        ///Creates an iterator pointing to the element i of v
+        basic_iterator(Vector* v, std::size_t i) : vec(v), index(i) {}
+        ///Converts an iterator to a const_iterator
+        template<class V>
+        basic_iterator(const basic_iterator<V>& other, typename std::enable_if<std::is_convertible<V*,U*>::value>::type* =0) : vec(other.vector()), index(other.position()) {}
+
+        ///Returnes the vector the iterator walks
+        Vector* vector() const {
+            return(vec);
+        }
+
+        ///Returnes the index of the element pointed
+        std::size_t position() const {
+            return(index);
+        }
+
+        ///Operator ==
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {
+            return(a.index == b.index || equivalent(a,b));
+        }
+
+        ///Operator !=
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {
+            return(!(a==b));
+        }
+
+        ///Operator <
+        friend bool operator<(const basic_iterator& a, const basic_iterator& b) {
+            return(a.index < b.index);
+        }
+
+        ///Operator >
+        friend bool operator>(const basic_iterator& a, const basic_iterator& b) {
+            return(a.index > b.index);
+        }
+
+        ///Operator <=
+        friend bool operator<=(const basic_iterator& a, const basic_iterator& b) {
+            return(a.index <= b.index);
+        }
+
+        ///Operator >=
+        friend bool operator>=(const basic_iterator& a, const basic_iterator& b) {
+            return(a.index >= b.index);
+        }
+
+        ///Operator ++ (prefix): moves to the next element, skipping the holes
+        basic_iterator& operator++() {
+            do {
+                ++index;
+            } while (vec->is_hole(index));
+            return(*this);
+        }
+
+        ///Operator ++ (postfix)
+        basic_iterator operator++(int) {
+            basic_iterator tmp(*this);
+            ++(*this);
+            return(tmp);
+        }
+
+        ///Operator -- (prefix): moves to the previous element, skipping the holes
+        basic_iterator& operator--() {
+            do {
+                --index;
+            } while (index>0 && vec->is_hole(index));
+            return(*this);
+        }
+
+        ///Operator -- (postfix)
+        basic_iterator operator--(int) {
+            basic_iterator tmp(*this);
+            --(*this);
+            return(tmp);
+        }
+
+        ///Operator +=
+        basic_iterator& operator+=(difference_type n) {
+            index+=n;
+            return(*this);
+        }
+
+        ///Operator -=
+        basic_iterator& operator-=(difference_type n) {
+            index-=n;
+            return(*this);
+        }
+
+        ///Operator +
+        friend basic_iterator operator+(basic_iterator it, difference_type n) {
+            return(it+=n);
+        }
+
+        ///Operator + (with the offset first)
+        friend basic_iterator operator+(difference_type n, basic_iterator it) {
+            return(it+=n);
+        }
+
+        ///Operator -
+        friend basic_iterator operator-(basic_iterator it, difference_type n) {
+            return(it-=n);
+        }
+
+        ///Operator -: the distance between two iterators in O(1)
+        friend difference_type operator-(const basic_iterator& a, const basic_iterator& b) {
+            return(static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index));
+        }
+
+        ///Operator *: returns by reference
+        U& operator*() const {
+            return((*vec)[index]);
+        }
+
+        ///Operator ->
+        U* operator->() const {
+            return(&(*vec)[index]);
+        }
+
+        ///Operator []
+        U& operator[](difference_type n) const {
+            return((*vec)[index+n]);
+        }
+    };
+
+    typedef basic_iterator<T> iterator;
+    typedef basic_iterator<const T> const_iterator;
+
+    ///Constructs an element at the end of the vector forwarding args to its constructor, returnes an iterator to it
+    template<class... Args>
+    iterator emplace_back(Args&&... args) {
+        typedef std::integral_constant<bool, std::is_nothrow_constructible<T,Args&&...>::value || !std::is_nothrow_move_constructible<T>::value> in_place;
+        return(iterator(this, append_one(in_place(), std::forward<Args>(args)...)));
+    }
+
+    ///Inserts an element at the end of the vector, returnes an iterator to it
+    iterator push_back(const T& val) {
+        return(emplace_back(val));
+    }
+
+    ///Inserts an element at the end of the vector moving it in place, returnes an iterator to it
+    iterator push_back(T&& val) {
+        return(emplace_back(std::move(val)));
+    }
+
+    ///Appends n value-initialized elements with a single atomic operation, returnes an iterator to the first one.
+    ///The new elements are adjacent even when other threads are appending, they are built in place:
+    ///if a constructor throws, the remaining slots become holes
+    iterator grow_by(std::size_t n) {
+        return(iterator(this, append(n)));
+    }
+
+    ///Appends n copies of val with a single atomic operation, returnes an iterator to the first one
+    iterator grow_by(std::size_t n, const T& val) {
+        return(iterator(this, append(n, val)));
+    }
+
+    ///Creates an iterator pointing to the first element of the vector
+    iterator begin() {
+        return(iterator(this,first_element()));
+    }
+
+    ///Creates an iterator pointing after the elements ready when it is called
+    iterator end() {
+        return(iterator(this,size()));
+    }
+
+    ///Creates a const_iterator pointing to the first element of the vector
+    const_iterator begin() const {
+        return(const_iterator(this,first_element()));
+    }
+
+    ///Creates a const_iterator pointing after the elements ready when it is called
+    const_iterator end() const {
+        return(const_iterator(this,size()));
+    }
+
+    ///Creates a const_iterator pointing to the first element of the vector
+    const_iterator cbegin() const {
+        return(const_iterator(this,first_element()));
+    }
+
+    ///Creates a const_iterator pointing after the elements ready when it is called
+    const_iterator cend() const {
+        return(const_iterator(this,size()));
+    }
+};
+
+}
+#endif
@@ -0,0 +1,542 @@
+///\file mydeque.h
+///\brief The deque container
+///
+///It contains implementation of a double ended queue made of fixed-size blocks, with the relative iterators
+
+#ifndef MYSTL_MYDEQUE_H
+#define MYSTL_MYDEQUE_H
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "myallocator.h"
+
+///Isolates MySTL Classes and functions names
+namespace mystl {
+
+///\class MyDeque
+///\brief A double ended queue storing its elements in blocks of B elements
+///
+///The blocks are listed by a map of pointers, kept centered so that there is room on both sides.
+///push_front() and push_back() are O(1): they fill the first or the last block and allocate a new one
+///when it is full, growing the map only by copying pointers. Elements are never moved, so a reference
+///to an element stays valid until the element is removed, whatever is inserted at the two ends.
+///Inside a block the elements are contiguous, so a scan runs at the speed of a vector and follows one
+///pointer every B elements. A block left empty by a pop is kept aside and reused by the next push,
+///so a queue moving its elements from one end to the other does not call the allocator at all.
+///By default a block takes about 4KB.
+///It contains an inner class template, basic_iterator, instantiated as iterator and const_iterator
+template<class T, std::size_t B = (sizeof(T)<256 ? 4096/sizeof(T) : 16), class Alloc = MyAllocator<T> >
+class MyDeque {
+    static_assert(B>0, "A block of MyDeque must hold at least one element");
+
+private:
+    //typename is required for the compiler to know what we mean cfr.:Stourstrup C.13.5
+    typedef typename std::allocator_traits<Alloc>::template rebind_alloc<T*> MapAlloc;
+
+    ///The map of the blocks, unused entries are 0
+    T** _map;
+    ///The number of entries of the map
+    std::size_t _map_size;
+    ///The slot of the first element, counting the slots of the blocks listed by the map from the beginning
+    std::size_t _first;
+    ///The number of elements
+    std::size_t _size;
+    ///An empty block kept for the next push, 0 if none
+    T* _spare;
+    ///The allocator providing the blocks
+    Alloc _alloc;
+
+    ///Returnes an empty block, the spare one if any
+    T* take_block() {
+        T* block=_spare;
+        if (block==0) {
+            block=_alloc.allocate(B);
+        } else {
+            _spare=0;
+        }
+        return(block);
+    }
+
+    ///Gives an empty block back, it becomes the spare one if there is none
+    void give_block(T* block) {
+        if (_spare==0) {
+            _spare=block;
+        } else {
+            _alloc.deallocate(block,B);
+        }
+    }
+
+    ///Makes room for a block on both sides of the ones in use: the map is recentered if it is less than
+    ///half full, otherwise it is doubled. Only the pointers to the blocks are copied
+    void grow_map() {
+        const std::size_t first_block=_first/B;
+        const std::size_t used = _size==0 ? 0 : (_first+_size-1)/B-first_block+1;
+        std::size_t new_size=_map_size;
+        if (used*2+2>_map_size) {
+            new_size = _map_size==0 ? 8 : _map_size*2;
+        }
+        const std::size_t new_first=(new_size-used)/2;
+        T** map=_map;
+        if (new_size!=_map_size) {
+            MapAlloc alloc(_alloc);
+            map=alloc.allocate(new_size);
+        }
+        if (used>0) {
+            //the ranges overlap when the map is only recentered
+            std::memmove(map+new_first, _map+first_block, used*sizeof(T*));
+        }
+        for (std::size_t k=0; k<new_first; ++k) {
+            map[k]=0;
+        }
+        for (std::size_t k=new_first+used; k<new_size; ++k) {
+            map[k]=0;
+        }
+        if (map!=_map && _map!=0) {
+            MapAlloc alloc(_alloc);
+            alloc.deallocate(_map,_map_size);
+        }
+        _map=map;
+        _map_size=new_size;
+        _first=new_first*B+_first%B;
+    }
+
+    ///Moves the first slot to the middle of the map once the deque is empty, so that both ends have room
+    void recenter_empty() {
+        if (_size==0) {
+            _first=_map_size/2*B;
+        }
+    }
+
+    ///Constructs an element in slot p forwarding args to its constructor, allocating its block if needed
+    template<class... Args>
+    void construct_at(std::size_t p, Args&&... args) {
+        T*& block=_map[p/B];
+        const bool fresh = block==0;
+        if (fresh) {
+            block=take_block();
+        }
+        try {
+            new (block+p%B) T(std::forward<Args>(args)...);
+        } catch (...) {
+            if (fresh) {
+                give_block(block);
+                block=0;
+            }
+            throw;
+        }
+    }
+
+    ///Gives back the memory of the blocks and of the map, the deque must be empty
+    void release() {
+        if (_spare!=0) {
+            _alloc.deallocate(_spare,B);
+            _spare=0;
+        }
+        if (_map!=0) {
+            MapAlloc alloc(_alloc);
+            alloc.deallocate(_map,_map_size);
+            _map=0;
+        }
+        _map_size=0;
+        _first=0;
+    }
+
+    ///Takes the content of other, which must be released, leaving it empty
+    void steal(MyDeque& other) {
+        _map=other._map;
+        _map_size=other._map_size;
+        _first=other._first;
+        _size=other._size;
+        _spare=other._spare;
+        other._map=0;
+        other._map_size=0;
+        other._first=0;
+        other._size=0;
+        other._spare=0;
+    }
+
+public:
+    ///Creates an empty deque, no storage is allocated until the first element is inserted
+    MyDeque(const Alloc& alloc=Alloc()) : _map(0), _map_size(0), _first(0), _size(0), _spare(0), _alloc(alloc) {}
+
+    ///Creates a deque from another one copying every element, the allocator is copied too
+    MyDeque(const MyDeque& other) : _map(0), _map_size(0), _first(0), _size(0), _spare(0), _alloc(other._alloc) {
+        try {
+            *this=other;
+        } catch (...) {
+            clear();
+            release();
+            throw;
+        }
+    }
+
+    ///Creates a deque stealing the content of another one, which is left empty
+    MyDeque(MyDeque&& other) noexcept : _map(0), _map_size(0), _first(0), _size(0), _spare(0), _alloc(other._alloc) {
+        steal(other);
+    }
+
+    ///Deletes a deque after clearing his content
+    ~MyDeque() {
+        clear();
+        release();
+    }
+
+    ///Operator= Copy element by element
+    MyDeque& operator=(const MyDeque& other) {
+        if (this!=&other) {
+            clear();
+            for (std::size_t i=0; i<other._size; ++i) {
+                push_back(other[i]);
+            }
+        }
+        return(*this);
+    }
+
+    ///Operator = (move): releases the current content and steals the one of other when their allocators
+    ///are equal, otherwise the elements are moved one by one into storage of this allocator
+    MyDeque& operator=(MyDeque&& other) noexcept(allocator_always_equal<Alloc>::value) {
+        if (this!=&other) {
+            clear();
+            if (allocator_always_equal<Alloc>::value || _alloc==other._alloc) {
+                release();
+                steal(other);
+            } else {
+                for (std::size_t i=0; i<other._size; ++i) {
+                    push_back(std::move(other[i]));
+                }
+                other.clear();
+            }
+        }
+        return(*this);
+    }
+
+    ///Operator []
+    T& operator[](std::size_t n) {
+        const std::size_t p=_first+n;
+        return(_map[p/B][p%B]);
+    }
+
+    ///Operator [] on a constant deque
+    const T& operator[](std::size_t n) const {
+        const std::size_t p=_first+n;
+        return(_map[p/B][p%B]);
+    }
+
+    ///Returnes TRUE if the deque is empty
+    bool empty() const {
+        return(_size==0);
+    }
+
+    ///Returnes the size of the deque
+    std::size_t size() const {
+        return(_size);
+    }
+
+    ///Returnes a copy of the allocator
+    Alloc get_allocator() const {
+        return(_alloc);
+    }
+
+    ///Deletes the content of the deque, the map and one block are kept for the next insertions
+    void clear() {
+        for (std::size_t i=0; i<_size; ++i) {
+            (*this)[i].~T();
+        }
+        if (_size>0) {
+            const std::size_t last=(_first+_size-1)/B;
+            for (std::size_t k=_first/B; k<=last; ++k) {
+                give_block(_map[k]);
+                _map[k]=0;
+            }
+        }
+        _size=0;
+        recenter_empty();
+    }
+
+    ///Gives back the spare block
+    void shrink_to_fit() {
+        if (_spare!=0) {
+            _alloc.deallocate(_spare,B);
+            _spare=0;
+        }
+    }
+
+    ///Returnes the value of the first element of the deque
+    T front() {
+        if(_size==0) {
+            throw std::out_of_range("Empty Deque");
+        } else {
+            return((*this)[0]);
+        }
+    }
+
+    ///Returnes the value of the last element of the deque
+    T back() {
+        if(_size==0) {
+            throw std::out_of_range("Empty Deque");
+        } else {
+            return((*this)[_size-1]);
+        }
+    }
+
+    ///Constructs an element at the beginning of the deque forwarding args to its constructor
+    template<class... Args>
+    void emplace_front(Args&&... args) {
+        if (_first==0) {
+            grow_map();
+        }
+        construct_at(_first-1, std::forward<Args>(args)...);
+        --_first;
+        ++_size;
+    }
+
+    ///Constructs an element at the end of the deque forwarding args to its constructor
+    template<class... Args>
+    void emplace_back(Args&&... args) {
+        if ((_first+_size)/B==_map_size) {
+            grow_map();
+        }
+        construct_at(_first+_size, std::forward<Args>(args)...);
+        ++_size;
+    }
+
+    ///Inserts an element at the beginning of the deque
+    void push_front(const T& val) {
+        emplace_front(val);
+    }
+
+    ///Inserts an element at the beginning of the deque moving it in place
+    void push_front(T&& val) {
+        emplace_front(std::move(val));
+    }
+
+    ///Inserts an element at the end of the deque
+    void push_back(const T& val) {
+        emplace_back(val);
+    }
+
+    ///Inserts an element at the end of the deque moving it in place
+    void push_back(T&& val) {
+        emplace_back(std::move(val));
+    }
+
+    ///Deletes the element at the beginning of the deque
+    void pop_front() {
+        if(_size==0) {
+            throw std::out_of_range("Empty Deque");
+        } else {
+            const std::size_t p=_first;
+            T*& block=_map[p/B];
+            block[p%B].~T();
+            ++_first;
+            --_size;
+            if (p%B==B-1 || _size==0) {
+                give_block(block);
+                block=0;
+            }
+            recenter_empty();
+        }
+    }
+
+    ///Deletes the element at the end of the deque
+    void pop_back() {
+        if(_size==0) {
+            throw std::out_of_range("Empty Deque");
+        } else {
+            const std::size_t p=_first+_size-1;
+            T*& block=_map[p/B];
+            block[p%B].~T();
+            --_size;
+            if (p%B==0 || _size==0) {
+                give_block(block);
+                block=0;
+            }
+            recenter_empty();
+        }
+    }
+
+    ///\class basic_iterator
+    ///\brief A random access iterator for MyDeque
+    ///
+    ///iterator (U=T) and const_iterator (U=const T) are its two instances, an iterator converts to a const_iterator.
+    ///It points to an entry of the map and to a slot of its block: it is invalidated when the map grows,
+    ///while the element it points to is not
+    template<class U>
+    class basic_iterator {
+    private:
+        T* const* node;
+        std::size_t slot;
+        template<class V> friend class basic_iterator;
+
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef typename std::remove_const<U>::type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef U* pointer;
+        typedef U& reference;
+
+        basic_iterator() : node(0), slot(0) {}
+        ///Creates an iterator from an entry of the map and a slot of its block
+        basic_iterator(T* const* n, std::size_t s) : node(n), slot(s) {}
+        ///Converts an iterator to a const_iterator
+        template<class V>
+        basic_iterator(const basic_iterator<V>& other, typename std::enable_if<std::is_convertible<V*,U*>::value>::type* =0) : node(other.node), slot(other.slot) {}
+
+        ///Operator ==
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {
+            return(a.node == b.node && a.slot == b.slot);
+        }
+
+        ///Operator !=
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {
+            return(!(a == b));
+        }
+
+        ///Operator <
+        friend bool operator<(const basic_iterator& a, const basic_iterator& b) {
+            return(a.node < b.node || (a.node == b.node && a.slot < b.slot));
+        }
+
+        ///Operator >
+        friend bool operator>(const basic_iterator& a, const basic_iterator& b) {
+            return(b < a);
+        }
+
+        ///Operator <=
+        friend bool operator<=(const basic_iterator& a, const basic_iterator& b) {
+            return(!(b < a));
+        }
+
+        ///Operator >=
+        friend bool operator>=(const basic_iterator& a, const basic_iterator& b) {
+            return(!(a < b));
+        }
+
+        ///Operator ++ (prefix)
+        basic_iterator& operator++() {
+            if (++slot == B) {
+                ++node;
+                slot=0;
+            }
+            return(*this);
+        }
+
+        ///Operator ++ (postfix)
+        basic_iterator operator++(int) {
+            basic_iterator tmp(*this);
+            ++(*this);
+            return(tmp);
+        }
+
+        ///Operator -- (prefix)
+        basic_iterator& operator--() {
+            if (slot == 0) {
+                --node;
+                slot=B;
+            }
+            --slot;
+            return(*this);
+        }
+
+        ///Operator -- (postfix)
+        basic_iterator operator--(int) {
+            basic_iterator tmp(*this);
+            --(*this);
+            return(tmp);
+        }
+
+        ///Operator +=
+        basic_iterator& operator+=(difference_type n) {
+            const difference_type block=static_cast<difference_type>(B);
+            const difference_type pos=static_cast<difference_type>(slot)+n;
+            //the division rounds toward zero, the blocks before the current one are counted by hand
+            const difference_type shift = pos>=0 ? pos/block : -((-pos-1)/block)-1;
+            node+=shift;
+            slot=static_cast<std::size_t>(pos-shift*block);
+            return(*this);
+        }
+
+        ///Operator -=
+        basic_iterator& operator-=(difference_type n) {
+            return(*this+=-n);
+        }
+
+        ///Operator +
+        friend basic_iterator operator+(basic_iterator it, difference_type n) {
+            return(it+=n);
+        }
+
+        ///Operator + (with the offset first)
+        friend basic_iterator operator+(difference_type n, basic_iterator it) {
+            return(it+=n);
+        }
+
+        ///Operator -
+        friend basic_iterator operator-(basic_iterator it, difference_type n) {
+            return(it-=n);
+        }
+
+        ///Operator -: the distance between two iterators in O(1)
+        friend difference_type operator-(const basic_iterator& a, const basic_iterator& b) {
+            return((a.node-b.node)*static_cast<difference_type>(B) + static_cast<difference_type>(a.slot) - static_cast<difference_type>(b.slot));
+        }
+
+        ///Operator *: returns by reference
+        U& operator*() const {
+            return((*node)[slot]);
+        }
+
+        ///Operator ->
+        U* operator->() const {
+            return(*node+slot);
+        }
+
+        ///Operator []
+        U& operator[](difference_type n) const {
+            return(*(*this+n));
+        }
+    };
+
+    typedef basic_iterator<T> iterator;
+    typedef basic_iterator<const T> const_iterator;
+
+    ///Creates an iterator pointing to the first element
+    iterator begin() {
+        return(iterator(_map+_first/B, _first%B));
+    }
+
+    ///Creates an iterator pointing after the last element
+    iterator end() {
+        return(iterator(_map+(_first+_size)/B, (_first+_size)%B));
+    }
+
+    ///Creates a const_iterator pointing to the first element
+    const_iterator begin() const {
+        return(const_iterator(_map+_first/B, _first%B));
+    }
+
+    ///Creates a const_iterator pointing after the last element
+    const_iterator end() const {
+        return(const_iterator(_map+(_first+_size)/B, (_first+_size)%B));
+    }
+
+    ///Creates a const_iterator pointing to the first element
+    const_iterator cbegin() const {
+        return(begin());
+    }
+
+    ///Creates a const_iterator pointing after the last element
+    const_iterator cend() const {
+        return(end());
+    }
+};
+
+}
+#endif
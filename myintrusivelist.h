@@ -0,0 +1,309 @@
+///\file myintrusivelist.h
+///\brief The intrusive list container
+///
+///It contains implementation of a double linked list whose links are embedded in the elements, with the relative iterators
+
+#ifndef MYSTL_MYINTRUSIVELIST_H
+#define MYSTL_MYINTRUSIVELIST_H
+
+#include <cstddef>
+#include <stdexcept>
+
+///Isolates MySTL Classes and functions names
+namespace mystl {
+
+///\class MyListHook
+///\brief The links an object needs to be stored in a MyIntrusiveList
+///
+///A class declares one hook member for every intrusive list it can belong to at the same time.
+///Copying an object does not copy its links: the copy starts outside of any list.
+class MyListHook {
+public:
+    MyListHook() : next(0), prev(0) {}
+    ///Creates an unlinked hook, the links of other are not copied
+    MyListHook(const MyListHook&) : next(0), prev(0) {}
+    ///Operator =: the links are left untouched
+    MyListHook& operator=(const MyListHook&) {
+        return(*this);
+    }
+
+    ///Returnes TRUE if the object is in a list
+    bool is_linked() const {
+        return(next!=0);
+    }
+
+    ///The next hook in the list
+    MyListHook* next;
+    ///The previous hook in the list
+    MyListHook* prev;
+};
+
+///\class MyIntrusiveList
+///\brief A double linked list of objects that carry their own links
+///
+///The list never allocates, copies or deletes its elements: it links objects owned by someone else
+///through their Hook member, so an object can be unlinked in O(1) knowing only its reference.
+///The objects must outlive their stay in the list.
+///It contains 2 inner classes: iterator and reverse_iterator
+template<class T, MyListHook T::* Hook>
+class MyIntrusiveList {
+
+private:
+    ///The sentinel closing the circular chain of hooks: it is both before the first element and after the last
+    MyListHook _root;
+    ///The size of the list
+    int _size;
+
+    MyIntrusiveList(const MyIntrusiveList&);
+    MyIntrusiveList& operator=(const MyIntrusiveList&);
+
+    ///Returnes the hook of an object
+    static MyListHook* hook(T& obj) {
+        return(&(obj.*Hook));
+    }
+
+    ///Returnes the object owning a hook, its address is the one of the hook minus the offset of Hook in T
+    static T* owner(MyListHook* h) {
+        const std::ptrdiff_t offset = reinterpret_cast<char*>(&(reinterpret_cast<T*>(h)->*Hook)) - reinterpret_cast<char*>(h);
+        return(reinterpret_cast<T*>(reinterpret_cast<char*>(h) - offset));
+    }
+
+    ///Links obj before the hook pos
+    void link_before(MyListHook* pos, T& obj) {
+        MyListHook* h=hook(obj);
+        if (h->is_linked()) {
+            throw std::invalid_argument("Object already in a list");
+        }
+        h->next=pos;
+        h->prev=pos->prev;
+        pos->prev->next=h;
+        pos->prev=h;
+        ++_size;
+    }
+
+    ///Unlinks a hook
+    void unlink(MyListHook* h) {
+        h->prev->next=h->next;
+        h->next->prev=h->prev;
+        h->next=0;
+        h->prev=0;
+        --_size;
+    }
+
+public:
+    ///\class iterator
+    ///\brief A bidirectional iterator for MyIntrusiveList
+    class iterator {
+    private:
+        MyListHook* elem;
+        friend class MyIntrusiveList;
+
+    public:
+        iterator() : elem(0) {}
+        ///Creates an iterator from a pointer to a hook
+        iterator(MyListHook* p) : elem(p) {}
+
+        ///Operator ==
+        bool operator==(const iterator& other) const {
+            return(elem == other.elem);
+        }
+
+        ///Operator !=
+        bool operator!=(const iterator& other) const {
+            return(elem != other.elem);
+        }
+
+        ///Operator ++ (prefix)
+        iterator& operator++() {
+            elem = elem->next;
+            return(*this);
+        }
+
+        ///Operator ++ (postfix)
+        iterator operator++(int) {
+            iterator tmp(*this);
+            ++(*this);
+            return(tmp);
+        }
+
+        ///Operator -- (prefix)
+        iterator& operator--() {
+            elem = elem->prev;
+            return(*this);
+        }
+
+        ///Operator -- (postfix)
+        iterator operator--(int) {
+            iterator tmp(*this);
+            --(*this);
+            return(tmp);
+        }
+
+        ///Operator *: returns by reference
+        T& operator*() const {
+            return(*owner(elem));
+        }
+    };
+
+    ///\class reverse_iterator
+    ///\brief A reverse iterator for MyIntrusiveList
+    class reverse_iterator {
+    private:
+        MyListHook* elem;
+
+    public:
+        reverse_iterator() : elem(0) {}
+        ///Creates a reverse_iterator from a pointer to a hook
+        reverse_iterator(MyListHook* p) : elem(p) {}
+
+        ///Operator ==
+        bool operator==(const reverse_iterator& other) const {
+            return(elem == other.elem);
+        }
+
+        ///Operator !=
+        bool operator!=(const reverse_iterator& other) const {
+            return(elem != other.elem);
+        }
+
+        ///Operator ++ (prefix)
+        reverse_iterator& operator++() {
+            elem = elem->prev;
+            return(*this);
+        }
+
+        ///Operator ++ (postfix)
+        reverse_iterator operator++(int) {
+            reverse_iterator tmp(*this);
+            ++(*this);
+            return(tmp);
+        }
+
+        ///Operator *: returns by reference
+        T& operator*() const {
+            return(*owner(elem));
+        }
+    };
+
+    ///Creates an empty list
+    MyIntrusiveList() : _size(0) {
+        _root.next=&_root;
+        _root.prev=&_root;
+    }
+
+    ///Deletes a list unlinking its elements, the objects themselves are untouched
+    ~MyIntrusiveList() {
+        clear();
+    }
+
+    ///Returnes TRUE if the list is empty
+    bool empty() const {
+        return(_size==0);
+    }
+
+    ///Returnes the size of the list
+    int size() const {
+        return(_size);
+    }
+
+    ///Unlinks all the elements, the objects themselves are untouched
+    void clear() {
+        while (_root.next!=&_root) {
+            unlink(_root.next);
+        }
+    }
+
+    ///Returnes the first element of the list by reference
+    T& front() {
+        if(_size==0) {
+            throw std::out_of_range("Empty List");
+        } else {
+            return(*owner(_root.next));
+        }
+    }
+
+    ///Returnes the last element of the list by reference
+    T& back() {
+        if(_size==0) {
+            throw std::out_of_range("Empty List");
+        } else {
+            return(*owner(_root.prev));
+        }
+    }
+
+    ///Links an object at the beginning of the list
+    void push_front(T& obj) {
+        link_before(_root.next,obj);
+    }
+
+    ///Links an object at the end of the list
+    void push_back(T& obj) {
+        link_before(&_root,obj);
+    }
+
+    ///Unlinks the element at the beginning of the list
+    void pop_front() {
+        if(_size==0) {
+            throw std::out_of_range("Empty List");
+        } else {
+            unlink(_root.next);
+        }
+    }
+
+    ///Unlinks the element at the end of the list
+    void pop_back() {
+        if(_size==0) {
+            throw std::out_of_range("Empty List");
+        } else {
+            unlink(_root.prev);
+        }
+    }
+
+    ///Links an object before pos, returnes an iterator to it
+    iterator insert(iterator pos, T& obj) {
+        link_before(pos.elem,obj);
+        return(iterator(hook(obj)));
+    }
+
+    ///Unlinks an object of this list in O(1).
+    ///The object must be in this list, it throws std::invalid_argument if it is in no list at all
+    void erase(T& obj) {
+        MyListHook* h=hook(obj);
+        if (!h->is_linked()) {
+            throw std::invalid_argument("Object not in a list");
+        }
+        unlink(h);
+    }
+
+    ///Unlinks the element at pos, returnes an iterator to the following one
+    iterator erase(iterator pos) {
+        MyListHook* next=pos.elem->next;
+        unlink(pos.elem);
+        return(iterator(next));
+    }
+
+    ///Creates an iterator pointing to an object of this list
+    static iterator iterator_to(T& obj) {
+        return(iterator(hook(obj)));
+    }
+
+    ///Creates an iterator pointing to the first element of the list
+    iterator begin() {
+        return(iterator(_root.next));
+    }
+    ///Creates an iterator pointing after the end of the list
+    iterator end() {
+        return(iterator(&_root));
+    }
+    ///Creates a reverse_iterator pointing to the last element of the list
+    reverse_iterator rbegin() {
+        return(reverse_iterator(_root.prev));
+    }
+    ///Creates a reverse_iterator pointing before the beginning of the list
+    reverse_iterator rend() {
+        return(reverse_iterator(&_root));
+    }
+};
+
+}
+#endif
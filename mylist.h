@@ -6,7 +6,17 @@
 #ifndef MYSTL_MYLIST_H
 #define MYSTL_MYLIST_H
 
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <new>
 #include <stdexcept>
+#include <memory>
+#include <utility>
+
+#include "myallocator.h"
+#include "myserializer.h"
 
 ///Isolates MySTL Classes and functions names
 namespace mystl {
@@ -16,24 +26,28 @@ namespace mystl {
 ///
 ///This class is meant as a programming exercise, It mimcs std::list behaviour.
 ///It contains 3 inner classes: Elem, iterator and reverse_iterator
+///The elements are obtained from an allocator of type Alloc (MyAllocator by default) rebound to Elem.
+///They are carved out of contiguous blocks and the ones deleted are recycled by later insertions,
+///so neighbouring elements tend to be neighbours in memory too.
+///Elements spliced into another list keep their storage: the list deleting them gives their slots back
+///to the blocks they come from, which live until the last of their elements is deleted
 ///
 ///\author Mauro Baluda
 ///Contact: mauro@bglug.it
-template<class T>
+template<class T, class Alloc = MyAllocator<T> >
 class MyList {
 
 private:
 
     ///\class Elem
     ///\brief An element of the list
+    struct Slab;
+
     class Elem {
     public:
-        ///Creates an element and stores his value
-        Elem(const T& val): next(0), prev(0), val(val) {}
-        ///Deletes an element and all the subsequent ones
-        ~Elem() {
-            delete next;
-        }
+        ///Creates an element building his value in place from args
+        template<class... Args>
+        Elem(Args&&... args): next(0), prev(0), slab(0), val(std::forward<Args>(args)...) {}
         ///Extract the value from an element
         T& getVal() {
             return(val);
@@ -42,6 +56,8 @@ private:
         Elem* next;
         ///The previous element in the list
         Elem* prev;
+        ///The storage of the list that created the element
+        Slab* slab;
     private:
         T val;
     };
@@ -53,21 +69,312 @@ private:
     ///The size of the list
     int _size;
 
-public:
-    ///Creates an empty list
-    MyList() : _front(0), _back(0), _size(0) {}
+    //typename is required for the compiler to know what we mean cfr.:Stourstrup C.13.5
+    typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Elem> ElemAlloc;
+
+    ///\brief The default ordering of the elements, through operator <
+    struct Less {
+        bool operator()(const T& a, const T& b) const {
+            return(a<b);
+        }
+    };
+
+    ///\brief The default equivalence of the elements, through operator ==
+    struct Equal {
+        bool operator()(const T& a, const T& b) const {
+            return(a==b);
+        }
+    };
+
+    ///The allocator providing the blocks of elements
+    ElemAlloc _alloc;
+
+    ///\brief A free slot of a block, linked in the free list
+    struct Slot {
+        Slot* next;
+    };
+
+    ///\brief The header stored in the first slot of every block
+    struct Block {
+        ///The previous block
+        Elem* next;
+        ///The number of slots following the header
+        int count;
+    };
+
+    static_assert(sizeof(Block)<=sizeof(Elem), "A block header must fit an element slot");
+
+    ///The weight of a living owner in Slab::refs, larger than any number of elements
+    static const long long OWNED = 1LL<<62;
+
+    ///\brief The part of the storage of a list reachable from its elements.
+    ///Other lists deleting them push the slots onto returned, the owner collects them when it runs out of slots.
+    ///refs is OWNED while the owner lives, minus the slots returned and not yet collected; when the owner dies
+    ///it hands over its blocks and refs drops to the number of its elements living in other lists:
+    ///the list deleting the last one releases the blocks
+    struct Slab {
+        Slab(const ElemAlloc& a) : returned(0), refs(OWNED), alloc(a), blocks(0) {}
+        std::atomic<Slot*> returned;
+        std::atomic<long long> refs;
+        ElemAlloc alloc;
+        Elem* blocks;
+    };
+
+    typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Slab> SlabAlloc;
+
+    ///The most recent block of elements
+    Elem* _blocks;
+    ///The slots given back by deleted elements
+    Slot* _free;
+    ///The number of slots in the free list
+    int _free_count;
+    ///The first never used slot of the most recent block
+    Elem* _bump;
+    ///The end of the most recent block
+    Elem* _bump_end;
+    ///The size of the next block allocated when the list runs out of slots
+    int _block_nodes;
+    ///The storage shared with the elements, 0 until the first block is allocated
+    Slab* _slab;
+    ///The elements created from the blocks of this list minus the ones deleted by this list or collected from _slab
+    long long _lent;
+
+    ///Puts the storage of an element into the free list
+    void recycle(Elem* p) {
+        Slot* slot = new (static_cast<void*>(p)) Slot;
+        slot->next=_free;
+        _free=slot;
+        ++_free_count;
+    }
+
+    ///Allocates a new block of count slots, the unused slots of the previous one go to the free list
+    void grow(int count) {
+        if (_slab==0) {
+            SlabAlloc slab_alloc(_alloc);
+            Slab* slab=slab_alloc.allocate(1);
+            _slab = new (static_cast<void*>(slab)) Slab(_alloc);
+        }
+        Elem* block = _alloc.allocate(count+1);
+        while (_bump!=_bump_end) {
+            recycle(_bump++);
+        }
+        Block* header = new (static_cast<void*>(block)) Block;
+        header->next=_blocks;
+        header->count=count;
+        _blocks=block;
+        _bump=block+1;
+        _bump_end=block+1+count;
+    }
+
+    ///Gives the blocks and the slab back to the allocator
+    static void release_slab(Slab* slab) {
+        ElemAlloc alloc(slab->alloc);
+        while (slab->blocks!=0) {
+            Block* header = reinterpret_cast<Block*>(slab->blocks);
+            Elem* next=header->next;
+            alloc.deallocate(slab->blocks,header->count+1);
+            slab->blocks=next;
+        }
+        SlabAlloc slab_alloc(alloc);
+        slab->~Slab();
+        slab_alloc.deallocate(slab,1);
+    }
+
+    ///Hands the blocks over to the slab, every element of this list must have been destroyed.
+    ///They are released now unless some of their elements live in other lists
+    void release_blocks() {
+        if (_slab!=0) {
+            _slab->blocks=_blocks;
+            if (_slab->refs.fetch_add(_lent-OWNED, std::memory_order_acq_rel)+_lent-OWNED==0) {
+                release_slab(_slab);
+            }
+        }
+        _slab=0;
+        _lent=0;
+        _blocks=0;
+        _free=0;
+        _free_count=0;
+        _bump=0;
+        _bump_end=0;
+    }
+
+    ///Moves the slots returned by other lists to the free list
+    void collect() {
+        if (_slab==0 || _slab->returned.load(std::memory_order_relaxed)==0) {
+            return;
+        }
+        Slot* slot=_slab->returned.exchange(0, std::memory_order_acquire);
+        long long count=0;
+        while (slot!=0) {
+            Slot* next=slot->next;
+            recycle(reinterpret_cast<Elem*>(slot));
+            ++count;
+            slot=next;
+        }
+        _lent-=count;
+        _slab->refs.fetch_add(count, std::memory_order_acq_rel);
+    }
+
+    ///Gives the slot of a destroyed element created by another list back to its slab
+    static void give_back(Elem* p, Slab* slab) {
+        Slot* slot = new (static_cast<void*>(p)) Slot;
+        slot->next=slab->returned.load(std::memory_order_relaxed);
+        while (!slab->returned.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed)) {}
+        if (slab->refs.fetch_sub(1, std::memory_order_acq_rel)==1) {
+            release_slab(slab);
+        }
+    }
+
+    ///Takes a slot (recycled ones first) and builds an element from args in it
+    template<class... Args>
+    Elem* create_node(Args&&... args) {
+        Elem* p;
+        if (_free==0) {
+            collect();
+        }
+        if (_free!=0) {
+            p=reinterpret_cast<Elem*>(_free);
+            _free=_free->next;
+            --_free_count;
+        } else {
+            if (_bump==_bump_end) {
+                grow(_block_nodes);
+                //blocks grow geometrically up to a few thousand elements
+                if (_block_nodes<4096) {
+                    _block_nodes*=2;
+                }
+            }
+            p=_bump++;
+        }
+        try {
+            new (p) Elem(std::forward<Args>(args)...);
+        } catch (...) {
+            recycle(p);
+            throw;
+        }
+        p->slab=_slab;
+        ++_lent;
+        return(p);
+    }
+
+    ///Destroys an element and puts its slot into the free list, or gives it back if another list created it
+    void destroy_node(Elem* p) {
+        Slab* slab=p->slab;
+        p->~Elem();
+        if (slab==_slab) {
+            recycle(p);
+            --_lent;
+        } else {
+            give_back(p,slab);
+        }
+    }
 
-    ///Creates a list from another one using the operator=
-    MyList(const MyList& other): _front(0), _back(0), _size(0) {
+    ///Links the chain first..last (both included) before pos, at the end of the list if pos is 0.
+    ///The size is not updated
+    void link_before(Elem* pos, Elem* first, Elem* last) {
+        last->next=pos;
+        if (pos==0) {
+            first->prev=_back;
+            if (_back==0) {
+                _front=first;
+            } else {
+                _back->next=first;
+            }
+            _back=last;
+        } else {
+            first->prev=pos->prev;
+            if (pos->prev==0) {
+                _front=first;
+            } else {
+                pos->prev->next=first;
+            }
+            pos->prev=last;
+        }
+    }
+
+    ///Unlinks the chain first..last (both included) from the list. The size is not updated
+    void unlink(Elem* first, Elem* last) {
+        if (first->prev==0) {
+            _front=last->next;
+        } else {
+            first->prev->next=last->next;
+        }
+        if (last->next==0) {
+            _back=first->prev;
+        } else {
+            last->next->prev=first->prev;
+        }
+        first->prev=0;
+        last->next=0;
+    }
+
+    ///Relinks the chain first..last (both included) of other before pos, the allocators must be equal
+    void relink_before(Elem* pos, MyList& other, Elem* first, Elem* last) {
+        int count=1;
+        for (Elem* e=first; e!=last; e=e->next) {
+            ++count;
+        }
+        other.unlink(first,last);
+        other._size-=count;
+        link_before(pos,first,last);
+        _size+=count;
+    }
+
+    ///Moves the elements of the chain first..last (both included) of other into new elements before pos
+    void move_before(Elem* pos, MyList& other, Elem* first, Elem* last) {
+        Elem* stop=last->next;
+        while (first!=stop) {
+            Elem* next=first->next;
+            Elem* e=create_node(std::move(first->getVal()));
+            link_before(pos,e,e);
+            ++_size;
+            other.unlink(first,first);
+            other.destroy_node(first);
+            --other._size;
+            first=next;
+        }
+    }
+
+    ///Merges two sorted chains linked only through next and ended by 0.
+    ///On equal elements the ones of a come first
+    template<class Compare>
+    static Elem* merge_chains(Elem* a, Elem* b, Compare& comp) {
+        Elem* head=0;
+        Elem** tail=&head;
+        while (a!=0 && b!=0) {
+            if (comp(b->getVal(),a->getVal())) {
+                *tail=b;
+                b=b->next;
+            } else {
+                *tail=a;
+                a=a->next;
+            }
+            tail=&(*tail)->next;
+        }
+        *tail = a!=0 ? a : b;
+        return(head);
+    }
+
+public:
+    ///Creates an empty list whose elements will be obtained from alloc
+    MyList(const Alloc& alloc=Alloc()) : _front(0), _back(0), _size(0), _alloc(alloc),
+        _blocks(0), _free(0), _free_count(0), _bump(0), _bump_end(0), _block_nodes(16), _slab(0), _lent(0) {}
+
+    ///Creates a list from another one using the operator=, the allocator is copied too
+    MyList(const MyList& other): _front(0), _back(0), _size(0), _alloc(other._alloc),
+        _blocks(0), _free(0), _free_count(0), _bump(0), _bump_end(0), _block_nodes(16), _slab(0), _lent(0) {
+        reserve_nodes(other._size);
         *this=other;
     }
 
     ///Operator= Copy element by element
     MyList& operator=(const MyList& other) {
-        clear();
-        //typename is required for the compiler to know what we mean cfr.:Stourstrup C.13.5
-        for (typename mystl::MyList<T>::iterator it = other._front; it != other._back; ++it) {
-            this->push_back(*it);
+        if (this!=&other) {
+            clear();
+            reserve_nodes(other._size);
+            for (Elem* e = other._front; e != 0; e = e->next) {
+                this->push_back(e->getVal());
+            }
         }
 
         return(*this);
@@ -76,6 +383,7 @@ public:
     ///Deletes a list after clearing his content
     ~MyList() {
         clear();
+        release_blocks();
     }
 
     ///Returnes TRUE if the list is empty
@@ -88,14 +396,66 @@ public:
         return(_size);
     }
 
-    ///Deletes te content of the list
+    ///Makes room for n elements: the list can grow up to n elements without allocating memory
+    void reserve_nodes(int n) {
+        collect();
+        const int missing = n - _size - _free_count - static_cast<int>(_bump_end-_bump);
+        if (missing>0) {
+            grow(missing);
+        }
+    }
+
+    ///Returnes a copy of the allocator
+    Alloc get_allocator() const {
+        return(Alloc(_alloc));
+    }
+
+    ///Deletes te content of the list, the memory is kept for the elements inserted later.
+    ///Elements are destroyed in a loop, so the depth of the call stack does not depend on the size
     void clear() {
-        delete _front;
-        _front=0;
+        while (_front!=0) {
+            Elem* tmp = _front;
+            _front = _front->next;
+            destroy_node(tmp);
+        }
         _back=0;
         _size=0;
     }
 
+    ///Writes the list to out in the format of myserializer.h, one MySerializer record per element
+    void save(std::ostream& out) const {
+        mywrite_header<T>(out, _size);
+        for (Elem* e = _front; e != 0; e = e->next) {
+            MySerializer<T>::write(out, e->getVal());
+        }
+        if (!out) {
+            throw std::runtime_error("Cannot save the list");
+        }
+    }
+
+    ///Replaces the content with a list read from in, as written by save() (or by MyVector::save()).
+    ///The nodes are reserved from the header up to a chunk (see myload_chunk()), the following ones grow as usual.
+    ///It throws std::runtime_error on a malformed input, and std::bad_alloc when memory runs out, leaving the list empty
+    void load(std::istream& in) {
+        clear();
+        const uint64_t count = myread_header<T>(in);
+        if (count>static_cast<uint64_t>(std::numeric_limits<int>::max())) {
+            throw std::runtime_error("Saved list too long");
+        }
+        reserve_nodes(static_cast<int>(myload_chunk<Elem>(count)));
+        try {
+            //the nodes are linked here rather than by emplace_back(), which would swallow a bad_alloc
+            for (uint64_t i=0; i<count; ++i) {
+                Elem* tmp = create_node(MySerializer<T>::read(in));
+                link_before(0, tmp, tmp);
+                ++_size;
+            }
+        } catch (...) {
+            clear();
+            throw;
+        }
+    }
+
     ///Returnes the value of the first element of the list
     T front() {
         if(_front==0) {
@@ -114,36 +474,56 @@ public:
         }
     }
 
-    ///Inserts an element at the beginning of the list
-    void push_front(const T& val) {
+    ///Constructs an element at the beginning of the list forwarding args to its constructor
+    template<class... Args>
+    void emplace_front(Args&&... args) {
         try {
+            Elem* tmp = create_node(std::forward<Args>(args)...);
             if(_front==0) {
-                _front = new Elem(val);
-                _back = _front;
+                _back = tmp;
             } else {
-                Elem* tmp = new Elem(val);
                 tmp->next = _front;
                 _front->prev = tmp;
-                _front = tmp;
             }
+            _front = tmp;
+            ++_size;
         } catch (const std::bad_alloc&) {}
-        ++_size;
     }
 
-    ///Inserts an element at the end of the list
-    void push_back(const T& val) {
+    ///Constructs an element at the end of the list forwarding args to its constructor
+    template<class... Args>
+    void emplace_back(Args&&... args) {
         try {
+            Elem* tmp = create_node(std::forward<Args>(args)...);
             if(_front==0) {
-                _front = new Elem(val);
-                _back = _front;
+                _front = tmp;
             } else {
-                Elem* tmp = new Elem(val);
                 tmp->prev = _back;
                 _back->next = tmp;
-                _back = tmp;
             }
+            _back = tmp;
+            ++_size;
         } catch (const std::bad_alloc&) {}
-        ++_size;
+    }
+
+    ///Inserts an element at the beginning of the list
+    void push_front(const T& val) {
+        emplace_front(val);
+    }
+
+    ///Inserts an element at the beginning of the list moving it in place
+    void push_front(T&& val) {
+        emplace_front(std::move(val));
+    }
+
+    ///Inserts an element at the end of the list
+    void push_back(const T& val) {
+        emplace_back(val);
+    }
+
+    ///Inserts an element at the end of the list moving it in place
+    void push_back(T&& val) {
+        emplace_back(std::move(val));
     }
 
     ///Deletes an element at the beginning of the list
@@ -154,9 +534,12 @@ public:
             Elem* tmp = _front;
             _front = _front->next;
 
-            _front->prev=0;
-            tmp->next = 0;
-            delete tmp;
+            if (_front==0) {
+                _back=0;
+            } else {
+                _front->prev=0;
+            }
+            destroy_node(tmp);
             _size--;
         }
     }
@@ -169,9 +552,12 @@ public:
             Elem* tmp = _back;
             _back = _back->prev;
 
-            _back->next=0;
-            tmp->prev = 0;
-            delete tmp;
+            if (_back==0) {
+                _front=0;
+            } else {
+                _back->next=0;
+            }
+            destroy_node(tmp);
             _size--;
         }
     }
@@ -181,8 +567,15 @@ public:
     class iterator {
     private:
         Elem* elem;
+        friend class MyList;
 
     public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T* pointer;
+        typedef T& reference;
+
         iterator() : elem(0) {}
         ///Creates an iterator from a pointer to an element
         iterator(Elem* p) : elem(p) {}
@@ -195,12 +588,12 @@ public:
         }
 
         ///Operator ==
-        bool operator==(const iterator& other) {
+        bool operator==(const iterator& other) const {
             return(elem == other.elem);
         }
 
         ///Operator !=
-        bool operator!=(const iterator& other) {
+        bool operator!=(const iterator& other) const {
             return(elem != other.elem);
         }
 
@@ -212,17 +605,22 @@ public:
             return(*this);
         }
 
-        ///Operator ++ (postfix)
-        iterator& operator++(int) {
-            iterator& tmp=*this;
+        ///Operator ++ (postfix): returnes the position before the increment
+        iterator operator++(int) {
+            iterator tmp(*this);
             ++(*this);
             return(tmp);
         }
 
         ///Operator *: returns by reference
-        T& operator*() {
+        T& operator*() const {
             return(elem->getVal());
         }
+
+        ///Operator ->
+        T* operator->() const {
+            return(&elem->getVal());
+        }
     };
 
     ///\class reverse_iterator
@@ -244,11 +642,11 @@ public:
         }
 
         ///Operator ==
-        bool operator==(const reverse_iterator& other) {
+        bool operator==(const reverse_iterator& other) const {
             return(elem == other.elem);
         }
         ///Operator !=
-        bool operator!=(const reverse_iterator& other) {
+        bool operator!=(const reverse_iterator& other) const {
             return(elem != other.elem);
         }
 
@@ -260,15 +658,15 @@ public:
             return(*this);
         }
 
-        ///Operator ++ (postfix)
-        reverse_iterator& operator++(int) {
+        ///Operator ++ (postfix): returnes the position before the increment
+        reverse_iterator operator++(int) {
             reverse_iterator tmp(*this);
             ++(*this);
             return(tmp);
         }
 
         ///Operator *: returns by reference
-        T& operator*() {
+        T& operator*() const {
             return(elem->getVal());
         }
     };
@@ -289,6 +687,216 @@ public:
     reverse_iterator rend() {
         return(reverse_iterator(0));
     }
+
+    ///Exchanges the content of two lists in O(1), iterators keep pointing to the same elements
+    void swap(MyList& other) {
+        std::swap(_front,other._front);
+        std::swap(_back,other._back);
+        std::swap(_size,other._size);
+        std::swap(_alloc,other._alloc);
+        std::swap(_blocks,other._blocks);
+        std::swap(_free,other._free);
+        std::swap(_free_count,other._free_count);
+        std::swap(_bump,other._bump);
+        std::swap(_bump_end,other._bump_end);
+        std::swap(_block_nodes,other._block_nodes);
+        std::swap(_slab,other._slab);
+        std::swap(_lent,other._lent);
+    }
+
+    ///Moves all the elements of other before pos, other is left empty.
+    ///The elements are relinked in O(1) keeping their storage, so no value is copied or moved
+    ///and iterators to them stay valid. Only if the allocators differ the values are moved into new elements
+    void splice(iterator pos, MyList& other) {
+        if (this==&other || other._front==0) {
+            return;
+        }
+        if (_alloc==other._alloc) {
+            Elem* first=other._front;
+            Elem* last=other._back;
+            other._front=0;
+            other._back=0;
+            link_before(pos.elem,first,last);
+            _size+=other._size;
+            other._size=0;
+        } else {
+            move_before(pos.elem,other,other._front,other._back);
+        }
+    }
+
+    ///Moves the element pointed by it from other before pos, relinking it in O(1).
+    ///Only if the allocators differ its value is moved into a new element
+    void splice(iterator pos, MyList& other, iterator it) {
+        if (it.elem==pos.elem || (this==&other && it.elem->next==pos.elem)) {
+            return;
+        }
+        if (this==&other) {
+            unlink(it.elem,it.elem);
+            link_before(pos.elem,it.elem,it.elem);
+        } else if (_alloc==other._alloc) {
+            relink_before(pos.elem,other,it.elem,it.elem);
+        } else {
+            move_before(pos.elem,other,it.elem,it.elem);
+        }
+    }
+
+    ///Moves the elements in [first,last) from other before pos.
+    ///Within the same list the range is relinked in O(1), pos must not be inside it.
+    ///From another list it is relinked in O(n) to count its elements, no value is copied or moved
+    ///unless the allocators differ
+    void splice(iterator pos, MyList& other, iterator first, iterator last) {
+        if (first==last) {
+            return;
+        }
+        Elem* back = last.elem==0 ? other._back : last.elem->prev;
+        if (this==&other) {
+            if (pos.elem!=last.elem) {
+                unlink(first.elem,back);
+                link_before(pos.elem,first.elem,back);
+            }
+        } else if (_alloc==other._alloc) {
+            relink_before(pos.elem,other,first.elem,back);
+        } else {
+            move_before(pos.elem,other,first.elem,back);
+        }
+    }
+
+    ///Sorts the list with a stable bottom-up merge sort in O(n log n).
+    ///Only the links are changed: no value is copied and no memory is allocated
+    void sort() {
+        sort(Less());
+    }
+
+    ///Sorts the list according to comp
+    template<class Compare>
+    void sort(Compare comp) {
+        if (_front==_back) {
+            return;
+        }
+        //bins[i] is either empty or a sorted chain of 2^i elements, older elements in higher bins
+        Elem* bins[64];
+        int fill=0;
+        Elem* e=_front;
+        while (e!=0) {
+            Elem* next=e->next;
+            e->next=0;
+            Elem* carry=e;
+            int i=0;
+            while (i<fill && bins[i]!=0) {
+                carry=merge_chains(bins[i],carry,comp);
+                bins[i]=0;
+                ++i;
+            }
+            bins[i]=carry;
+            if (i==fill) {
+                ++fill;
+            }
+            e=next;
+        }
+        Elem* sorted=0;
+        for (int i=0; i<fill; ++i) {
+            if (bins[i]!=0) {
+                sorted=merge_chains(bins[i],sorted,comp);
+            }
+        }
+        //restore the backward links
+        _front=sorted;
+        Elem* prev=0;
+        for (e=sorted; e!=0; e=e->next) {
+            e->prev=prev;
+            prev=e;
+        }
+        _back=prev;
+    }
+
+    ///Deletes all but the first element of every group of consecutive equal elements
+    void unique() {
+        unique(Equal());
+    }
+
+    ///Deletes all but the first element of every group of consecutive elements satisfying pred
+    template<class BinaryPredicate>
+    void unique(BinaryPredicate pred) {
+        if (_front==0) {
+            return;
+        }
+        Elem* e=_front;
+        while (e->next!=0) {
+            Elem* next=e->next;
+            if (pred(e->getVal(),next->getVal())) {
+                unlink(next,next);
+                destroy_node(next);
+                --_size;
+            } else {
+                e=next;
+            }
+        }
+    }
+
+    ///Deletes all the elements satisfying pred
+    template<class Predicate>
+    void remove_if(Predicate pred) {
+        Elem* e=_front;
+        while (e!=0) {
+            Elem* next=e->next;
+            if (pred(e->getVal())) {
+                unlink(e,e);
+                destroy_node(e);
+                --_size;
+            }
+            e=next;
+        }
+    }
+
+    ///Merges the sorted list other into this sorted one, other is left empty.
+    ///Elements are relinked in O(n+m) without copying values, equal elements of this list come first
+    void merge(MyList& other) {
+        merge(other,Less());
+    }
+
+    ///Merges the list other into this one, both sorted according to comp
+    template<class Compare>
+    void merge(MyList& other, Compare comp) {
+        if (this==&other || other._front==0) {
+            return;
+        }
+        if (!(_alloc==other._alloc)) {
+            //bring the values under our allocator first
+            MyList tmp(get_allocator());
+            tmp.splice(tmp.end(),other);
+            merge(tmp,comp);
+            return;
+        }
+        Elem* a=_front;
+        Elem* b=other._front;
+        other._front=0;
+        other._back=0;
+        while (a!=0 && b!=0) {
+            if (comp(b->getVal(),a->getVal())) {
+                Elem* next=b->next;
+                link_before(a,b,b);
+                b=next;
+            } else {
+                a=a->next;
+            }
+        }
+        if (b!=0) {
+            Elem* last=b;
+            while (last->next!=0) {
+                last=last->next;
+            }
+            link_before(0,b,last);
+        }
+        _size+=other._size;
+        other._size=0;
+    }
 };
+
+///Exchanges the content of two lists in O(1)
+template<class T, class Alloc>
+void swap(MyList<T,Alloc>& a, MyList<T,Alloc>& b) {
+    a.swap(b);
+}
+
 }
 #endif
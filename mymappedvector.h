@@ -0,0 +1,575 @@
+///\file mymappedvector.h
+///\brief The memory-mapped vector
+///
+///It contains a read-only vector whose elements live in a binary file mapped in memory, together with the
+///functions writing such files. Opening a file costs a mmap call: the elements are never parsed nor copied,
+///pages are read from disk by the kernel the first time they are touched.
+///It needs a POSIX system.
+///
+///The file starts with a MyMappedHeader in native byte order, the elements begin at byte data_offset:
+///- fixed-size elements (kind 0) are stored as an array of count trivially copyable records of elem_size bytes;
+///- strings (kind 1) are stored as a table of count+1 uint64_t offsets followed by a blob with their characters,
+///  string i spans the bytes [offsets[i],offsets[i+1]) of the blob.
+
+#ifndef MYSTL_MYMAPPEDVECTOR_H
+#define MYSTL_MYMAPPEDVECTOR_H
+
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "myvector.h"
+
+///Isolates MySTL Classes and functions names
+namespace mystl {
+
+///\brief The header of a MyMappedVector file
+struct MyMappedHeader {
+    ///The magic string "MYSTLVEC"
+    char magic[8];
+    ///The version of the format, MyMappedHeader::current_version when written
+    uint32_t version;
+    ///0 for fixed-size elements, 1 for strings
+    uint32_t kind;
+    ///MyMappedHeader::byte_order_mark as written by the producer, a different value means a different byte order
+    uint32_t byte_order;
+    ///Unused, always 0
+    uint32_t reserved;
+    ///The size of an element (1 for strings)
+    uint64_t elem_size;
+    ///The number of elements
+    uint64_t count;
+    ///The offset of the elements from the beginning of the file
+    uint64_t data_offset;
+
+    static const uint32_t current_version = 1;
+    static const uint32_t byte_order_mark = 0x01020304;
+    ///The elements start at this offset, enough to align any fundamental type and most vector types
+    static const uint64_t header_size = 64;
+
+    ///Creates the header of a file holding count elements of elem_size bytes of the given kind
+    MyMappedHeader(uint32_t k=0, uint64_t size=0, uint64_t n=0) : version(current_version), kind(k), byte_order(byte_order_mark), reserved(0), elem_size(size), count(n), data_offset(header_size) {
+        std::memcpy(magic, "MYSTLVEC", 8);
+    }
+
+    ///Writes the header padded to header_size bytes
+    void write(std::ostream& out) const {
+        char padded[header_size] = {0};
+        std::memcpy(padded, this, sizeof(MyMappedHeader));
+        out.write(padded, header_size);
+    }
+};
+
+///\class MyMappedFile
+///\brief A binary file mapped read-only in memory, checked against the MyMappedHeader format
+///
+///It is the storage shared by the MyMappedVector classes.
+class MyMappedFile {
+private:
+    ///The first byte of the mapping, 0 when nothing is mapped
+    const char* _base;
+    ///The length of the mapping
+    std::size_t _length;
+
+    MyMappedFile(const MyMappedFile&);
+    MyMappedFile& operator=(const MyMappedFile&);
+
+public:
+    ///Maps the file at path, throws std::runtime_error if it cannot be read or is not a file of the given kind and element size.
+    ///The elements must start after the header at a multiple of alignment, strings must have non-decreasing offsets
+    MyMappedFile(const std::string& path, uint32_t kind, uint64_t elem_size, uint64_t alignment) : _base(0), _length(0) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd<0) {
+            throw std::runtime_error("Cannot open "+path);
+        }
+        struct stat st;
+        if (::fstat(fd,&st)!=0 || static_cast<uint64_t>(st.st_size)<MyMappedHeader::header_size) {
+            ::close(fd);
+            throw std::runtime_error("Not a mapped vector file: "+path);
+        }
+        _length=static_cast<std::size_t>(st.st_size);
+        void* p = ::mmap(0, _length, PROT_READ, MAP_SHARED, fd, 0);
+        //the mapping keeps the file alive
+        ::close(fd);
+        if (p==MAP_FAILED) {
+            throw std::runtime_error("Cannot map "+path);
+        }
+        _base=static_cast<const char*>(p);
+
+        const MyMappedHeader& h = header();
+        const char* error = 0;
+        if (std::memcmp(h.magic, "MYSTLVEC", 8)!=0) {
+            error="Not a mapped vector file: ";
+        } else if (h.version!=MyMappedHeader::current_version) {
+            error="Unsupported mapped vector version: ";
+        } else if (h.byte_order!=MyMappedHeader::byte_order_mark) {
+            error="Mapped vector written with a different byte order: ";
+        } else if (h.kind!=kind || h.elem_size!=elem_size) {
+            error="Mapped vector of a different element type: ";
+        } else if (h.data_offset<MyMappedHeader::header_size || h.data_offset%alignment!=0) {
+            error="Misplaced elements in mapped vector file: ";
+        } else if (h.data_offset>_length || payload(h)>_length-h.data_offset) {
+            error="Truncated mapped vector file: ";
+        } else if (h.kind==1 && !sorted_offsets(h)) {
+            error="Corrupt string offsets in mapped vector file: ";
+        }
+        if (error!=0) {
+            ::munmap(const_cast<char*>(_base), _length);
+            throw std::runtime_error(error+path);
+        }
+    }
+
+    ///Unmaps the file
+    ~MyMappedFile() {
+        ::munmap(const_cast<char*>(_base), _length);
+    }
+
+    ///Returnes the header of the file
+    const MyMappedHeader& header() const {
+        return(*reinterpret_cast<const MyMappedHeader*>(_base));
+    }
+
+    ///Returnes the first byte of the elements
+    const char* data() const {
+        return(_base+header().data_offset);
+    }
+
+private:
+    ///Returnes the bytes the elements need after data_offset, a value larger than the file when it is truncated
+    uint64_t payload(const MyMappedHeader& h) const {
+        const uint64_t available = _length-h.data_offset;
+        if (h.kind==0) {
+            return(h.elem_size!=0 && h.count>available/h.elem_size ? available+1 : h.count*h.elem_size);
+        }
+        if (h.count>=available/sizeof(uint64_t)) {
+            return(available+1);
+        }
+        const uint64_t table = (h.count+1)*sizeof(uint64_t);
+        //the offsets table is aligned by data_offset
+        const uint64_t blob = reinterpret_cast<const uint64_t*>(_base+h.data_offset)[h.count];
+        return(blob>available-table ? available+1 : table+blob);
+    }
+
+    ///Returnes TRUE if the string offsets never decrease, so every string lies inside the blob checked by payload()
+    bool sorted_offsets(const MyMappedHeader& h) const {
+        const uint64_t* offsets = reinterpret_cast<const uint64_t*>(_base+h.data_offset);
+        for (uint64_t i=0; i<h.count; ++i) {
+            if (offsets[i]>offsets[i+1]) {
+                return(false);
+            }
+        }
+        return(true);
+    }
+};
+
+///\class MyMappedVector
+///\brief A read-only vector of trivially copyable elements mapped from a file
+///
+///It offers the constant part of the MyVector interface, its iterators are MyVector const_iterators.
+///Files are written by write() and must come from a machine with the same byte order and type layout.
+template<class T>
+class MyMappedVector {
+    static_assert(std::is_trivially_copyable<T>::value, "MyMappedVector stores trivially copyable elements (or std::string)");
+
+private:
+    MyMappedFile _file;
+
+public:
+    typedef typename MyVector<T>::const_iterator const_iterator;
+    typedef typename MyVector<T>::const_iterator iterator;
+    typedef typename MyVector<T>::const_reverse_iterator const_reverse_iterator;
+    typedef typename MyVector<T>::const_reverse_iterator reverse_iterator;
+
+    ///Maps the file at path, throws std::runtime_error if it does not hold elements of type T
+    explicit MyMappedVector(const std::string& path) : _file(path, 0, sizeof(T), alignof(T)) {}
+
+    ///Writes the elements in [first,last) to a new file at path
+    template<class In>
+    static void write(const std::string& path, In first, In last) {
+        std::ofstream out(path.c_str(), std::ios::binary|std::ios::trunc);
+        MyMappedHeader(0, sizeof(T), 0).write(out);
+        uint64_t n=0;
+        for(;first!=last;++first,++n) {
+            const T val(*first);
+            out.write(reinterpret_cast<const char*>(&val), sizeof(T));
+        }
+        //the count is known only at the end
+        out.seekp(0);
+        MyMappedHeader(0, sizeof(T), n).write(out);
+        if (!out) {
+            throw std::runtime_error("Cannot write "+path);
+        }
+    }
+
+    ///Writes the content of a vector to a new file at path with a single write
+    template<class Alloc, class Growth>
+    static void write(const std::string& path, const MyVector<T,Alloc,Growth>& v) {
+        std::ofstream out(path.c_str(), std::ios::binary|std::ios::trunc);
+        MyMappedHeader(0, sizeof(T), v.size()).write(out);
+        if (!v.empty()) {
+            out.write(reinterpret_cast<const char*>(&v[0]), v.size()*sizeof(T));
+        }
+        if (!out) {
+            throw std::runtime_error("Cannot write "+path);
+        }
+    }
+
+    ///Operator []
+    const T& operator[](std::size_t n) const {
+        return(data()[n]);
+    }
+
+    ///Returnes the mapped elements
+    const T* data() const {
+        return(reinterpret_cast<const T*>(_file.data()));
+    }
+
+    ///Returnes TRUE if the vector is empty
+    bool empty() const {
+        return(size()==0);
+    }
+
+    ///Returnes the size of the vector
+    std::size_t size() const {
+        return(static_cast<std::size_t>(_file.header().count));
+    }
+
+    ///Returnes the value of the first element of the vector
+    T front() const {
+        if(empty()) {
+            throw std::out_of_range("Empty Vector");
+        } else {
+            return(data()[0]);
+        }
+    }
+
+    ///Returnes the value of the last element of the vector
+    T back() const {
+        if(empty()) {
+            throw std::out_of_range("Empty Vector");
+        } else {
+            return(data()[size()-1]);
+        }
+    }
+
+    ///Creates an iterator pointing to the first element of the vector
+    const_iterator begin() const {
+        return(const_iterator(data()));
+    }
+
+    ///Creates an iterator pointing after the end of the vector
+    const_iterator end() const {
+        return(const_iterator(data()+size()));
+    }
+
+    ///Creates a reverse_iterator pointing to the last element of the vector
+    const_reverse_iterator rbegin() const {
+        return(const_reverse_iterator::from_base(data()+size()));
+    }
+
+    ///Creates a reverse_iterator pointing before the beginning of the vector
+    const_reverse_iterator rend() const {
+        return(const_reverse_iterator::from_base(data()));
+    }
+};
+
+///\class MyStringRef
+///\brief A reference to a string stored in a MyMappedVector: its characters are not copied
+class MyStringRef {
+private:
+    const char* _data;
+    std::size_t _size;
+
+public:
+    MyStringRef() : _data(0), _size(0) {}
+    ///Creates a reference to size characters starting at data
+    MyStringRef(const char* data, std::size_t size) : _data(data), _size(size) {}
+
+    ///Returnes the first character, the string is not null terminated
+    const char* data() const {
+        return(_data);
+    }
+
+    ///Returnes the number of characters
+    std::size_t size() const {
+        return(_size);
+    }
+
+    ///Returnes TRUE if the string is empty
+    bool empty() const {
+        return(_size==0);
+    }
+
+    ///Returnes a copy of the string
+    std::string str() const {
+        return(std::string(_data,_size));
+    }
+
+    ///Converts to a copy of the string
+    operator std::string() const {
+        return(str());
+    }
+
+    ///Operator ==
+    friend bool operator==(const MyStringRef& a, const MyStringRef& b) {
+        return(a._size==b._size && std::memcmp(a._data,b._data,a._size)==0);
+    }
+
+    ///Operator !=
+    friend bool operator!=(const MyStringRef& a, const MyStringRef& b) {
+        return(!(a==b));
+    }
+
+    ///Operator == with a string
+    friend bool operator==(const MyStringRef& a, const std::string& b) {
+        return(a._size==b.size() && std::memcmp(a._data,b.data(),a._size)==0);
+    }
+
+    ///Operator == with a string (string first)
+    friend bool operator==(const std::string& a, const MyStringRef& b) {
+        return(b==a);
+    }
+
+    ///Operator != with a string
+    friend bool operator!=(const MyStringRef& a, const std::string& b) {
+        return(!(a==b));
+    }
+
+    ///Operator != with a string (string first)
+    friend bool operator!=(const std::string& a, const MyStringRef& b) {
+        return(!(b==a));
+    }
+
+    ///Operator <<
+    friend std::ostream& operator<<(std::ostream& out, const MyStringRef& s) {
+        return(out.write(s._data, s._size));
+    }
+};
+
+///\class MyMappedVector<std::string>
+///\brief A read-only vector of strings mapped from a file
+///
+///The elements are read as MyStringRef pointing into the mapping, they stay valid as long as the vector.
+///It contains the inner class const_iterator, a random access iterator like the ones of MyVector
+template<>
+class MyMappedVector<std::string> {
+private:
+    MyMappedFile _file;
+
+    ///Returnes the offsets table
+    const uint64_t* offsets() const {
+        return(reinterpret_cast<const uint64_t*>(_file.data()));
+    }
+
+    ///Returnes the blob holding the characters
+    const char* blob() const {
+        return(_file.data()+(size()+1)*sizeof(uint64_t));
+    }
+
+public:
+    ///\class const_iterator
+    ///\brief A random access iterator for MyMappedVector<std::string>
+    class const_iterator {
+    private:
+        const MyMappedVector* vec;
+        std::size_t index;
+
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef MyStringRef value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const MyStringRef* pointer;
+        typedef MyStringRef reference;
+
+        const_iterator() : vec(0), index(0) {}
+        ///Creates an iterator pointing to the element i of v
+        const_iterator(const MyMappedVector* v, std::size_t i) : vec(v), index(i) {}
+
+        ///Operator ==
+        friend bool operator==(const const_iterator& a, const const_iterator& b) {
+            return(a.index == b.index);
+        }
+
+        ///Operator !=
+        friend bool operator!=(const const_iterator& a, const const_iterator& b) {
+            return(a.index != b.index);
+        }
+
+        ///Operator <
+        friend bool operator<(const const_iterator& a, const const_iterator& b) {
+            return(a.index < b.index);
+        }
+
+        ///Operator >
+        friend bool operator>(const const_iterator& a, const const_iterator& b) {
+            return(a.index > b.index);
+        }
+
+        ///Operator <=
+        friend bool operator<=(const const_iterator& a, const const_iterator& b) {
+            return(a.index <= b.index);
+        }
+
+        ///Operator >=
+        friend bool operator>=(const const_iterator& a, const const_iterator& b) {
+            return(a.index >= b.index);
+        }
+
+        ///Operator ++ (prefix)
+        const_iterator& operator++() {
+            ++index;
+            return(*this);
+        }
+
+        ///Operator ++ (postfix)
+        const_iterator operator++(int) {
+            const_iterator tmp(*this);
+            ++index;
+            return(tmp);
+        }
+
+        ///Operator -- (prefix)
+        const_iterator& operator--() {
+            --index;
+            return(*this);
+        }
+
+        ///Operator -- (postfix)
+        const_iterator operator--(int) {
+            const_iterator tmp(*this);
+            --index;
+            return(tmp);
+        }
+
+        ///Operator +=
+        const_iterator& operator+=(difference_type n) {
+            index+=n;
+            return(*this);
+        }
+
+        ///Operator -=
+        const_iterator& operator-=(difference_type n) {
+            index-=n;
+            return(*this);
+        }
+
+        ///Operator +
+        friend const_iterator operator+(const_iterator it, difference_type n) {
+            return(it+=n);
+        }
+
+        ///Operator + (offset first)
+        friend const_iterator operator+(difference_type n, const_iterator it) {
+            return(it+=n);
+        }
+
+        ///Operator -
+        friend const_iterator operator-(const_iterator it, difference_type n) {
+            return(it-=n);
+        }
+
+        ///Operator -: the distance between two iterators in O(1)
+        friend difference_type operator-(const const_iterator& a, const const_iterator& b) {
+            return(static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index));
+        }
+
+        ///Operator *: returns a reference to the characters in the mapping
+        MyStringRef operator*() const {
+            return((*vec)[index]);
+        }
+
+        ///Operator []
+        MyStringRef operator[](difference_type n) const {
+            return((*vec)[index+n]);
+        }
+    };
+
+    typedef const_iterator iterator;
+
+    ///Maps the file at path, throws std::runtime_error if it does not hold strings
+    explicit MyMappedVector(const std::string& path) : _file(path, 1, 1, alignof(uint64_t)) {}
+
+    ///Writes the strings in [first,last) to a new file at path, the range is walked twice:
+    ///once for the offsets table and once for the blob
+    template<class For>
+    static void write(const std::string& path, For first, For last) {
+        std::ofstream out(path.c_str(), std::ios::binary|std::ios::trunc);
+        uint64_t n=0;
+        for(For it=first;it!=last;++it) {
+            ++n;
+        }
+        MyMappedHeader(1, 1, n).write(out);
+        uint64_t offset=0;
+        out.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+        for(For it=first;it!=last;++it) {
+            const std::string& s=*it;
+            offset+=s.size();
+            out.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+        }
+        for(;first!=last;++first) {
+            const std::string& s=*first;
+            out.write(s.data(), s.size());
+        }
+        if (!out) {
+            throw std::runtime_error("Cannot write "+path);
+        }
+    }
+
+    ///Operator []
+    MyStringRef operator[](std::size_t n) const {
+        const uint64_t* o=offsets();
+        return(MyStringRef(blob()+o[n], static_cast<std::size_t>(o[n+1]-o[n])));
+    }
+
+    ///Returnes TRUE if the vector is empty
+    bool empty() const {
+        return(size()==0);
+    }
+
+    ///Returnes the size of the vector
+    std::size_t size() const {
+        return(static_cast<std::size_t>(_file.header().count));
+    }
+
+    ///Returnes the first element of the vector
+    MyStringRef front() const {
+        if(empty()) {
+            throw std::out_of_range("Empty Vector");
+        } else {
+            return((*this)[0]);
+        }
+    }
+
+    ///Returnes the last element of the vector
+    MyStringRef back() const {
+        if(empty()) {
+            throw std::out_of_range("Empty Vector");
+        } else {
+            return((*this)[size()-1]);
+        }
+    }
+
+    ///Creates an iterator pointing to the first element of the vector
+    const_iterator begin() const {
+        return(const_iterator(this,0));
+    }
+
+    ///Creates an iterator pointing after the end of the vector
+    const_iterator end() const {
+        return(const_iterator(this,size()));
+    }
+};
+
+}
+#endif
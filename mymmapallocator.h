@@ -0,0 +1,150 @@
+///\file mymmapallocator.h
+///\brief The allocator for very large buffers
+///
+///It contains an allocator that maps large buffers straight from the kernel with mmap, so that a vector
+///growing into the gigabytes resizes its mapping instead of copying its content.
+///It needs a POSIX system, the growth without copies needs Linux (mremap).
+
+#ifndef MYSTL_MYMMAPALLOCATOR_H
+#define MYSTL_MYMMAPALLOCATOR_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+///Isolates MySTL Classes and functions names
+namespace mystl {
+
+///\class MyMmapAllocator
+///\brief An allocator mapping large buffers with mmap
+///
+///Requests of at least threshold bytes get their own anonymous mapping, smaller ones come from malloc.
+///Mapped pages are committed by the kernel only when they are first touched, and reallocate() grows a
+///mapping with mremap, which moves page table entries instead of bytes: a MyVector of trivially copyable
+///elements never copies its content while growing and peaks at its own size instead of three times it.
+///With huge_pages the mappings are advised to use transparent huge pages, which lowers the TLB pressure
+///of scanning them. Allocators are interchangeable when they share the threshold.
+template<class T>
+class MyMmapAllocator {
+public:
+    typedef T value_type;
+
+    ///Creates an allocator mapping the requests of at least threshold bytes, huge_pages asks for transparent huge pages
+    explicit MyMmapAllocator(std::size_t threshold=1024*1024, bool huge_pages=false) : _threshold(threshold), _huge_pages(huge_pages) {}
+    ///Converts from an allocator of another type (rebind)
+    template<class U>
+    MyMmapAllocator(const MyMmapAllocator<U>& other) : _threshold(other.threshold()), _huge_pages(other.huge_pages()) {}
+
+    ///Allocates uninitialized storage for n elements
+    T* allocate(std::size_t n) {
+        const std::size_t bytes=n*sizeof(T);
+        if (!mapped(bytes)) {
+            void* p = std::malloc(bytes);
+            if (p==0) {
+                throw std::bad_alloc();
+            }
+            return(static_cast<T*>(p));
+        }
+        void* p = ::mmap(0, round(bytes), PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+        if (p==MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        advise(p, round(bytes));
+        return(static_cast<T*>(p));
+    }
+
+    ///Releases storage obtained from allocate()
+    void deallocate(T* p, std::size_t n) {
+        const std::size_t bytes=n*sizeof(T);
+        if (mapped(bytes)) {
+            ::munmap(p, round(bytes));
+        } else {
+            std::free(p);
+        }
+    }
+
+    ///Resizes storage obtained from allocate() from old_n to new_n elements, returnes its new address.
+    ///A mapping is resized by mremap, small buffers by realloc, a buffer crossing the threshold is copied.
+    ///The content is moved bytewise, so it is only meant for trivially copyable T
+    T* reallocate(T* p, std::size_t old_n, std::size_t new_n) {
+        const std::size_t old_bytes=old_n*sizeof(T);
+        const std::size_t new_bytes=new_n*sizeof(T);
+        if (!mapped(old_bytes) && !mapped(new_bytes)) {
+            void* q = std::realloc(p, new_bytes);
+            if (q==0) {
+                throw std::bad_alloc();
+            }
+            return(static_cast<T*>(q));
+        }
+#ifdef __linux__
+        if (mapped(old_bytes) && mapped(new_bytes)) {
+            void* q = ::mremap(p, round(old_bytes), round(new_bytes), MREMAP_MAYMOVE);
+            if (q==MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+            advise(q, round(new_bytes));
+            return(static_cast<T*>(q));
+        }
+#endif
+        T* q = allocate(new_n);
+        std::memcpy(static_cast<void*>(q), static_cast<const void*>(p), old_bytes<new_bytes ? old_bytes : new_bytes);
+        deallocate(p, old_n);
+        return(q);
+    }
+
+    ///Returnes the size in bytes from which requests are mapped
+    std::size_t threshold() const {
+        return(_threshold);
+    }
+
+    ///Returnes TRUE if the mappings use transparent huge pages
+    bool huge_pages() const {
+        return(_huge_pages);
+    }
+
+private:
+    std::size_t _threshold;
+    bool _huge_pages;
+
+    ///Returnes TRUE if a request of bytes gets its own mapping
+    bool mapped(std::size_t bytes) const {
+        return(bytes>0 && bytes>=_threshold);
+    }
+
+    ///Rounds bytes up to a whole number of pages
+    static std::size_t round(std::size_t bytes) {
+        static const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        return((bytes+page-1)/page*page);
+    }
+
+    ///Asks transparent huge pages for a mapping when requested
+    void advise(void* p, std::size_t bytes) const {
+#ifdef MADV_HUGEPAGE
+        if (_huge_pages) {
+            ::madvise(p, bytes, MADV_HUGEPAGE);
+        }
+#else
+        (void)p;
+        (void)bytes;
+#endif
+    }
+};
+
+///Operator ==: allocators are interchangeable when they share the threshold
+template<class T, class U>
+bool operator==(const MyMmapAllocator<T>& a, const MyMmapAllocator<U>& b) {
+    return(a.threshold()==b.threshold());
+}
+
+///Operator !=
+template<class T, class U>
+bool operator!=(const MyMmapAllocator<T>& a, const MyMmapAllocator<U>& b) {
+    return(a.threshold()!=b.threshold());
+}
+
+}
+#endif
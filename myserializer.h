@@ -0,0 +1,125 @@
+///\file myserializer.h
+///\brief The binary format used to save and load containers
+///
+///It contains the MySerializer class, which writes and reads single elements, and the functions
+///handling the header of a saved container.
+///A saved container is a header followed by its elements: the header holds the magic string "MYSTLSER",
+///the version of the format, the element size and the number of elements as uint64_t in native byte order.
+///The element size is sizeof(T) when the elements are raw bytes, then a vector is written and read with a
+///single call, and 0 when every element is a record written by MySerializer, like a length-prefixed string.
+///Vectors and lists share the format, so a saved vector can be loaded into a list and vice versa.
+
+#ifndef MYSTL_MYSERIALIZER_H
+#define MYSTL_MYSERIALIZER_H
+
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+
+///Isolates MySTL Classes and functions names
+namespace mystl {
+
+///\class MySerializer
+///\brief Writes and reads the elements of a saved container
+///
+///The general version handles trivially copyable types as raw bytes (bulk is TRUE).
+///Other types need a specialization with bulk set to FALSE, a write(out,val) and a read(in) method
+///throwing std::runtime_error when the input ends; MySTL provides the one for std::string.
+template<class T>
+class MySerializer {
+    static_assert(std::is_trivially_copyable<T>::value, "MySerializer needs a specialization for types that are not trivially copyable");
+
+public:
+    ///TRUE if a sequence of elements can be written as a single block of raw bytes
+    static const bool bulk = true;
+
+    ///Writes an element
+    static void write(std::ostream& out, const T& val) {
+        out.write(reinterpret_cast<const char*>(&val), sizeof(T));
+    }
+
+    ///Reads an element
+    static T read(std::istream& in) {
+        T val;
+        if (!in.read(reinterpret_cast<char*>(&val), sizeof(T))) {
+            throw std::runtime_error("Unexpected end of a saved container");
+        }
+        return(val);
+    }
+};
+
+///\class MySerializer<std::string>
+///\brief Writes a string as a record: its length as uint64_t followed by its characters
+template<>
+class MySerializer<std::string> {
+public:
+    static const bool bulk = false;
+
+    ///Writes a string
+    static void write(std::ostream& out, const std::string& val) {
+        MySerializer<uint64_t>::write(out, val.size());
+        out.write(val.data(), val.size());
+    }
+
+    ///Reads a string
+    static std::string read(std::istream& in) {
+        const uint64_t length = MySerializer<uint64_t>::read(in);
+        std::string val;
+        //the characters are read in chunks: a corrupted length must not allocate before the input ends
+        char chunk[4096];
+        for (uint64_t left=length; left>0; ) {
+            const std::size_t n = left<sizeof(chunk) ? static_cast<std::size_t>(left) : sizeof(chunk);
+            if (!in.read(chunk, n)) {
+                throw std::runtime_error("Unexpected end of a saved container");
+            }
+            val.append(chunk, n);
+            left-=n;
+        }
+        return(val);
+    }
+};
+
+///\brief Writes the header of a saved container of count elements of type T
+template<class T>
+void mywrite_header(std::ostream& out, std::size_t count) {
+    const uint32_t version = 1;
+    out.write("MYSTLSER", 8);
+    MySerializer<uint32_t>::write(out, version);
+    MySerializer<uint32_t>::write(out, 0);
+    MySerializer<uint64_t>::write(out, MySerializer<T>::bulk ? sizeof(T) : 0);
+    MySerializer<uint64_t>::write(out, count);
+}
+
+///\brief Returnes how many of the count elements announced by a header a container reserves before reading them:
+///at most about a megabyte, so a corrupted count hits the end of the input instead of allocating all of them
+template<class T>
+std::size_t myload_chunk(uint64_t count) {
+    const uint64_t chunk = sizeof(T)<(1<<20) ? (1<<20)/sizeof(T) : 1;
+    return(static_cast<std::size_t>(count<chunk ? count : chunk));
+}
+
+///\brief Reads the header of a saved container of elements of type T, returnes the number of elements.
+///It throws std::runtime_error if the input is not a container of T saved in this format
+template<class T>
+uint64_t myread_header(std::istream& in) {
+    char magic[8];
+    if (!in.read(magic, 8) || std::memcmp(magic, "MYSTLSER", 8)!=0) {
+        throw std::runtime_error("Not a saved container");
+    }
+    if (MySerializer<uint32_t>::read(in)!=1) {
+        throw std::runtime_error("Unsupported saved container version");
+    }
+    MySerializer<uint32_t>::read(in);
+    if (MySerializer<uint64_t>::read(in)!=(MySerializer<T>::bulk ? sizeof(T) : 0)) {
+        throw std::runtime_error("Saved container of a different element type");
+    }
+    return(MySerializer<uint64_t>::read(in));
+}
+
+}
+#endif
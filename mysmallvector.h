@@ -0,0 +1,73 @@
+///\file mysmallvector.h
+///\brief The small vector container
+///
+///It contains implementation of a dynamic array that keeps its first elements inside the object itself
+
+#ifndef MYSTL_MYSMALLVECTOR_H
+#define MYSTL_MYSMALLVECTOR_H
+
+#include <cstddef>
+#include <type_traits>
+
+#include "myvector.h"
+
+///Isolates MySTL Classes and functions names
+namespace mystl {
+
+///\class MySmallVector
+///\brief A vector with an inline buffer for up to N elements
+///
+///It is a MyVector, so it shares its interface and its iterators, but the first N elements
+///are stored inside the object: short sequences never touch the heap.
+///When the content outgrows the buffer it is moved to the heap as a plain MyVector would do.
+template<class T, std::size_t N, class Alloc = MyAllocator<T>, class Growth = MyDoublingGrowth>
+class MySmallVector : public MyVector<T,Alloc,Growth> {
+    static_assert(N>0, "MySmallVector needs room for at least one inline element");
+
+private:
+    ///The inline buffer, raw storage for N elements
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type buffer[N];
+
+    ///TRUE if moving a vector cannot throw: inline elements fit the target buffer and heap buffers are always stolen
+    static const bool nothrow_move = std::is_nothrow_move_constructible<T>::value && allocator_always_equal<Alloc>::value;
+
+public:
+    ///Creates an empty vector using the inline buffer, alloc provides the heap storage after an overflow
+    MySmallVector(const Alloc& alloc=Alloc()) : MyVector<T,Alloc,Growth>(reinterpret_cast<T*>(buffer), N, alloc) {}
+
+    ///Creates a vector from another one copying every element
+    MySmallVector(const MySmallVector& other) : MyVector<T,Alloc,Growth>(reinterpret_cast<T*>(buffer), N, other.get_allocator()) {
+        MyVector<T,Alloc,Growth>::operator=(other);
+    }
+
+    ///Creates a vector from any MyVector copying every element
+    MySmallVector(const MyVector<T,Alloc,Growth>& other) : MyVector<T,Alloc,Growth>(reinterpret_cast<T*>(buffer), N, other.get_allocator()) {
+        MyVector<T,Alloc,Growth>::operator=(other);
+    }
+
+    ///Creates a vector moving the content of another one, which is left empty.
+    ///Inline elements are moved one by one, a heap buffer is stolen.
+    ///It cannot fail unless moving an element or the allocator can (see allocator_always_equal)
+    MySmallVector(MySmallVector&& other) noexcept(nothrow_move)
+        : MyVector<T,Alloc,Growth>(reinterpret_cast<T*>(buffer), N, other.get_allocator()) {
+        MyVector<T,Alloc,Growth>::operator=(std::move(other));
+    }
+
+    ///Operator =
+    MySmallVector& operator=(const MySmallVector& other) {
+        MyVector<T,Alloc,Growth>::operator=(other);
+        return(*this);
+    }
+
+    ///Operator = (move)
+    MySmallVector& operator=(MySmallVector&& other) noexcept(nothrow_move) {
+        MyVector<T,Alloc,Growth>::operator=(std::move(other));
+        return(*this);
+    }
+
+    ///Returnes TRUE while the elements are stored in the inline buffer
+    using MyVector<T,Alloc,Growth>::is_inline;
+};
+
+}
+#endif
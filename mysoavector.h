@@ -0,0 +1,410 @@
+///\file mysoavector.h
+///\brief The structure of arrays container
+///
+///It contains implementation of a vector of records that stores every field in its own contiguous column,
+///with the relative row iterators and the spans over a single column
+
+#ifndef MYSTL_MYSOAVECTOR_H
+#define MYSTL_MYSOAVECTOR_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "myvector.h"
+
+///Isolates MySTL Classes and functions names
+namespace mystl {
+
+///\class MySpan
+///\brief A view of a contiguous sequence of elements owned by someone else
+///
+///Its iterators are plain pointers, so it works with every MySTL and Standard algorithm
+template<class T>
+class MySpan {
+private:
+    T* _data;
+    std::size_t _size;
+
+public:
+    typedef T* iterator;
+
+    MySpan() : _data(0), _size(0) {}
+    ///Creates a view of the size elements starting at data
+    MySpan(T* data, std::size_t size) : _data(data), _size(size) {}
+
+    ///Operator []
+    T& operator[](std::size_t n) const {
+        return(_data[n]);
+    }
+
+    ///Returnes the first element of the view
+    T* data() const {
+        return(_data);
+    }
+
+    ///Returnes the number of elements in the view
+    std::size_t size() const {
+        return(_size);
+    }
+
+    ///Returnes TRUE if the view is empty
+    bool empty() const {
+        return(_size==0);
+    }
+
+    ///Returnes a pointer to the first element
+    T* begin() const {
+        return(_data);
+    }
+
+    ///Returnes a pointer after the last element
+    T* end() const {
+        return(_data+_size);
+    }
+};
+
+///\brief A sequence of indices, used to expand the columns of a MySoAVector
+template<std::size_t... I>
+struct MyIndexSequence {};
+
+///\brief Builds MyIndexSequence<0,1,...,N-1> as its type member
+template<std::size_t N, std::size_t... I>
+struct MyMakeIndexSequence : MyMakeIndexSequence<N-1, N-1, I...> {};
+
+template<std::size_t... I>
+struct MyMakeIndexSequence<0, I...> {
+    typedef MyIndexSequence<I...> type;
+};
+
+///\class MySoAVector
+///\brief A vector of records stored as one MyVector per field (structure of arrays)
+///
+///A record with the fields Fields... is pushed as a std::tuple and read back as a tuple of references,
+///but the fields live in separate columns: a scan touching one field through column<I>() reads only
+///the bytes of that field, instead of dragging whole records through the cache.
+///All the columns always have the same size.
+///It contains an inner class template, basic_iterator, instantiated as iterator and const_iterator
+template<class... Fields>
+class MySoAVector {
+    static_assert(sizeof...(Fields)>0, "MySoAVector needs at least one field");
+
+public:
+    ///A record by value
+    typedef std::tuple<Fields...> value_type;
+    ///A record by reference: a proxy whose fields refer to the columns, assigning a value_type to it writes the record
+    typedef std::tuple<Fields&...> reference;
+    ///A constant record by reference
+    typedef std::tuple<const Fields&...> const_reference;
+
+private:
+    typedef typename MyMakeIndexSequence<sizeof...(Fields)>::type Indices;
+    ///The number of fields
+    static const std::size_t width = sizeof...(Fields);
+
+    ///The columns
+    std::tuple<MyVector<Fields>...> _columns;
+
+    ///Pushes the fields of a record from column K on; if a column throws the ones already grown are shrunk back
+    template<class Tuple, std::size_t K>
+    void push_columns(Tuple&& t, std::integral_constant<std::size_t,K>) {
+        std::get<K>(_columns).emplace_back(std::get<K>(std::forward<Tuple>(t)));
+        try {
+            push_columns(std::forward<Tuple>(t), std::integral_constant<std::size_t,K+1>());
+        } catch (...) {
+            std::get<K>(_columns).pop_back();
+            throw;
+        }
+    }
+
+    template<class Tuple>
+    void push_columns(Tuple&&, std::integral_constant<std::size_t,width>) {}
+
+    template<std::size_t... I>
+    reference row(std::size_t n, MyIndexSequence<I...>) {
+        return(reference(std::get<I>(_columns)[n]...));
+    }
+
+    template<std::size_t... I>
+    const_reference row(std::size_t n, MyIndexSequence<I...>) const {
+        return(const_reference(std::get<I>(_columns)[n]...));
+    }
+
+    template<std::size_t... I>
+    void pop_columns(MyIndexSequence<I...>) {
+        int expand[] = {(std::get<I>(_columns).pop_back(), 0)...};
+        (void)expand;
+    }
+
+    template<std::size_t... I>
+    void reserve_columns(std::size_t n, MyIndexSequence<I...>) {
+        int expand[] = {(std::get<I>(_columns).reserve(n), 0)...};
+        (void)expand;
+    }
+
+    template<std::size_t... I>
+    void clear_columns(MyIndexSequence<I...>) {
+        int expand[] = {(std::get<I>(_columns).clear(), 0)...};
+        (void)expand;
+    }
+
+public:
+    ///Creates an empty vector
+    MySoAVector() {}
+
+    ///Operator []: returnes the record n as a tuple of references
+    reference operator[](std::size_t n) {
+        return(row(n, Indices()));
+    }
+
+    ///Operator [] on a constant vector
+    const_reference operator[](std::size_t n) const {
+        return(row(n, Indices()));
+    }
+
+    ///Returnes the field I of the record n by reference
+    template<std::size_t I>
+    typename std::tuple_element<I, reference>::type get(std::size_t n) {
+        return(std::get<I>(_columns)[n]);
+    }
+
+    ///Returnes the field I of the record n of a constant vector
+    template<std::size_t I>
+    typename std::tuple_element<I, const_reference>::type get(std::size_t n) const {
+        return(std::get<I>(_columns)[n]);
+    }
+
+    ///Returnes a span over the column of the field I: its elements are contiguous
+    template<std::size_t I>
+    MySpan<typename std::tuple_element<I, value_type>::type> column() {
+        typename std::tuple_element<I, value_type>::type* first = std::get<I>(_columns).data();
+        return(MySpan<typename std::tuple_element<I, value_type>::type>(first, size()));
+    }
+
+    ///Returnes a span over the column of the field I of a constant vector
+    template<std::size_t I>
+    MySpan<const typename std::tuple_element<I, value_type>::type> column() const {
+        const typename std::tuple_element<I, value_type>::type* first = std::get<I>(_columns).data();
+        return(MySpan<const typename std::tuple_element<I, value_type>::type>(first, size()));
+    }
+
+    ///Returnes TRUE if the vector is empty
+    bool empty() const {
+        return(size()==0);
+    }
+
+    ///Returnes the number of records
+    std::size_t size() const {
+        return(std::get<0>(_columns).size());
+    }
+
+    ///Makes room for n records in every column
+    void reserve(std::size_t n) {
+        reserve_columns(n, Indices());
+    }
+
+    ///Deletes all the records
+    void clear() {
+        clear_columns(Indices());
+    }
+
+    ///Inserts a record at the end of the vector
+    void push_back(const value_type& val) {
+        push_columns(val, std::integral_constant<std::size_t,0>());
+    }
+
+    ///Inserts a record at the end of the vector moving its fields in place
+    void push_back(value_type&& val) {
+        push_columns(std::move(val), std::integral_constant<std::size_t,0>());
+    }
+
+    ///Inserts a record given field by field, every argument is forwarded to the constructor of its field
+    template<class... Args>
+    void emplace_back(Args&&... args) {
+        static_assert(sizeof...(Args)==width, "MySoAVector::emplace_back needs one argument per field");
+        push_columns(std::forward_as_tuple(std::forward<Args>(args)...), std::integral_constant<std::size_t,0>());
+    }
+
+    ///Deletes the record at the end of the vector
+    void pop_back() {
+        if(empty()) {
+            throw std::out_of_range("Empty Vector");
+        } else {
+            pop_columns(Indices());
+        }
+    }
+
+    ///\class basic_iterator
+    ///\brief A random access iterator over the records of MySoAVector
+    ///
+    ///iterator (Const=false) and const_iterator (Const=true) are its two instances, an iterator converts to a const_iterator.
+    ///Dereferencing yields a proxy, a tuple of references into the columns, rather than a real reference
+    template<bool Const>
+    class basic_iterator {
+    private:
+        typedef typename std::conditional<Const, const MySoAVector, MySoAVector>::type Vector;
+        Vector* vec;
+        std::size_t index;
+
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef typename MySoAVector::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef void pointer;
+        typedef typename std::conditional<Const, const_reference, typename MySoAVector::reference>::type reference;
+
+        basic_iterator() : vec(0), index(0) {}
+        ///Creates an iterator pointing to the record i of v
+        basic_iterator(Vector* v, std::size_t i) : vec(v), index(i) {}
+        ///Converts an iterator to a const_iterator
+        template<bool C>
+        basic_iterator(const basic_iterator<C>& other, typename std::enable_if<Const && !C>::type* =0) : vec(other.vector()), index(other.position()) {}
+
+        ///Returnes the vector the iterator walks
+        Vector* vector() const {
+            return(vec);
+        }
+
+        ///Returnes the index of the record pointed
+        std::size_t position() const {
+            return(index);
+        }
+
+        ///Operator ==
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {
+            return(a.index == b.index);
+        }
+
+        ///Operator !=
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {
+            return(a.index != b.index);
+        }
+
+        ///Operator <
+        friend bool operator<(const basic_iterator& a, const basic_iterator& b) {
+            return(a.index < b.index);
+        }
+
+        ///Operator >
+        friend bool operator>(const basic_iterator& a, const basic_iterator& b) {
+            return(a.index > b.index);
+        }
+
+        ///Operator <=
+        friend bool operator<=(const basic_iterator& a, const basic_iterator& b) {
+            return(a.index <= b.index);
+        }
+
+        ///Operator >=
+        friend bool operator>=(const basic_iterator& a, const basic_iterator& b) {
+            return(a.index >= b.index);
+        }
+
+        ///Operator ++ (prefix)
+        basic_iterator& operator++() {
+            ++index;
+            return(*this);
+        }
+
+        ///Operator ++ (postfix)
+        basic_iterator operator++(int) {
+            basic_iterator tmp(*this);
+            ++index;
+            return(tmp);
+        }
+
+        ///Operator -- (prefix)
+        basic_iterator& operator--() {
+            --index;
+            return(*this);
+        }
+
+        ///Operator -- (postfix)
+        basic_iterator operator--(int) {
+            basic_iterator tmp(*this);
+            --index;
+            return(tmp);
+        }
+
+        ///Operator +=
+        basic_iterator& operator+=(difference_type n) {
+            index+=n;
+            return(*this);
+        }
+
+        ///Operator -=
+        basic_iterator& operator-=(difference_type n) {
+            index-=n;
+            return(*this);
+        }
+
+        ///Operator +
+        friend basic_iterator operator+(basic_iterator it, difference_type n) {
+            return(it+=n);
+        }
+
+        ///Operator + (with the offset first)
+        friend basic_iterator operator+(difference_type n, basic_iterator it) {
+            return(it+=n);
+        }
+
+        ///Operator -
+        friend basic_iterator operator-(basic_iterator it, difference_type n) {
+            return(it-=n);
+        }
+
+        ///Operator -: the distance between two iterators in O(1)
+        friend difference_type operator-(const basic_iterator& a, const basic_iterator& b) {
+            return(static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index));
+        }
+
+        ///Operator *: returns the proxy of the record
+        reference operator*() const {
+            return((*vec)[index]);
+        }
+
+        ///Operator []
+        reference operator[](difference_type n) const {
+            return((*vec)[index+n]);
+        }
+    };
+
+    typedef basic_iterator<false> iterator;
+    typedef basic_iterator<true> const_iterator;
+
+    ///Creates an iterator pointing to the first record
+    iterator begin() {
+        return(iterator(this,0));
+    }
+
+    ///Creates an iterator pointing after the last record
+    iterator end() {
+        return(iterator(this,size()));
+    }
+
+    ///Creates a const_iterator pointing to the first record
+    const_iterator begin() const {
+        return(const_iterator(this,0));
+    }
+
+    ///Creates a const_iterator pointing after the last record
+    const_iterator end() const {
+        return(const_iterator(this,size()));
+    }
+
+    ///Creates a const_iterator pointing to the first record
+    const_iterator cbegin() const {
+        return(const_iterator(this,0));
+    }
+
+    ///Creates a const_iterator pointing after the last record
+    const_iterator cend() const {
+        return(const_iterator(this,size()));
+    }
+};
+
+}
+#endif
@@ -6,9 +6,19 @@
 #ifndef MYSTL
 #define MYSTL
 
+#include "myallocator.h"
+#include "mymmapallocator.h"
 #include "mylist.h"
+#include "myunrolledlist.h"
+#include "myintrusivelist.h"
 #include "myvector.h"
+#include "mysmallvector.h"
+#include "mymappedvector.h"
+#include "myconcurrentvector.h"
+#include "mysoavector.h"
+#include "mydeque.h"
 #include "myalgorithms.h"
+#include "myalignment.h"
 
 #endif
 
@@ -28,7 +38,31 @@ I created a file named mystl.h that aggregates all the header files, it can be i
 \subsection containers 2.1 Containers
 I decided to recreate two of the most used containers: vector and list. Their peculiar functions and behavior where implemented following the Standard specification as found in [2]. The standard also contains some performance requirements to which I adhered.
 
-related files: mylist.h, myvector.h
+MyUnrolledList is a list whose nodes hold a small array of elements each: it keeps the cheap insertions and deletions of a list while scanning almost as fast as a vector.
+
+MyIntrusiveList links objects that carry their own MyListHook members: it never allocates and unlinks an object in O(1) from its reference alone, as needed by LRU queues or run-queues.
+
+For short sequences MySmallVector keeps up to N elements inside the object itself and moves them to the heap only when they outgrow it, sharing the whole MyVector interface.
+
+MyMappedVector is a read-only vector mapped from a versioned binary file: opening it costs a mmap call instead of parsing, its elements are read in place. Fixed-size elements are stored as an array, strings as an offsets table followed by a blob of characters.
+
+MyConcurrentVector lets many threads append at the same time without locks: its elements live in segments of doubling size that are never moved, so their addresses and iterators stay valid while the vector grows.
+
+MySoAVector stores records as a structure of arrays, one contiguous MyVector per field: records are pushed as tuples and read back as tuples of references, while column<I>() gives a MySpan over a single field so that scans read only the bytes they need.
+
+MyDeque grows at both ends in O(1): its elements live in fixed-size blocks listed by a map of pointers, so growing copies pointers instead of elements, references stay valid and a scan reads contiguous blocks. Blocks freed by a pop are reused by the next push, so queues do not call the allocator in their steady state.
+
+Every container takes an allocator as a template parameter. Besides the default one, drawing from the global heap, MyArena offers a monotonic arena that frees a whole batch of containers at once and MyPool a free list of fixed-size chunks for objects allocated one at a time. MyList also recycles its own elements, which it carves out of contiguous blocks.
+
+Very large vectors can use MyMmapAllocator: buffers above a threshold are mapped with mmap, optionally on transparent huge pages, and grow through mremap without copying their content.
+
+MyAlignedAllocator returns storage aligned to a chosen power of two: MyAlignedVector<T,Align> uses it and pads its capacity to whole aligned blocks, so SIMD kernels can work on data() with aligned loads and no scalar tail.
+
+MyVector and MySmallVector also take a growth policy after the allocator: MyDoublingGrowth (the default), MyHalfGrowth or MyChunkGrowth trade reallocations for slack, and shrink_to_fit() gives the slack back.
+
+MyVector and MyList can be saved to and loaded from a binary stream: trivially copyable elements are written as raw bytes, a vector in a single call, other types as records written by MySerializer (length-prefixed for strings). Loading reserves the storage once from the header.
+
+related files: mylist.h, myunrolledlist.h, myintrusivelist.h, myvector.h, mysmallvector.h, mymappedvector.h, myconcurrentvector.h, mysoavector.h, mydeque.h, myallocator.h, mymmapallocator.h, myserializer.h
  
 \subsection iterators 2.2 Iterators
 I implemented direct and reverse iterators for the two containers (bidirectional for lists, random access for vectors) together with most of the required functions and operators.
@@ -38,11 +72,19 @@ related files: mylist.h, myvector.h
 
 \subsection algorithms 2.3 Algorithms
 I implemented a basic version of 4 functions included with the Standard Library: length(), find(), equal() and search(). They operate on iterators thus beeing completely independent from the actual container chosen to store the data.
+
+mysearch() also accepts a searcher object that preprocesses the searched sequence once for many texts: MyHorspoolSearcher skips most of a random access text, MyKmpSearcher reads a forward text once, and both run in linear time in the worst case.
  
 To give a "real world" example of the powerfulness of this generic programming approach, I included a simple version of an algorithm called "Levenshtein distance" which is used, for example, in bioinformatics to compare couples of biological sequences.\n 
 In the past I took part in a project called ALiBio implementing a much more sophisticated variant of this distance algorithm, that time I used a c-style approach which lead me to a less generic implementation.
 
-related files: myalgorithms.h
+myldist() keeps a single row of the matrix, so its memory is linear in the shorter sequence. When both sequences hold the same byte-sized or ordered type it runs Myers' bit-parallel algorithm instead, computing 64 cells with a few word operations; a MyBitPattern can be built once and matched against many texts.
+When only a threshold matters, myldist_bounded() computes a diagonal band of the matrix and stops as soon as the distance is known to exceed it.
+To compare one query with many candidates, myldist_batch() and myldist_nearest() (the k nearest ones) spread the candidates over a pool of threads, each reusing its own preprocessed copy of the query; a MyThreadPool passed to them keeps the same threads across calls.
+
+The alignment algorithms of that project are in myalignment.h in a generic form: myalign_global() (Needleman-Wunsch) and myalign_local() (Smith-Waterman) return the score and the edit script of an alignment with a substitution functor and affine gap penalties. They follow the divide and conquer of Hirschberg, as refined by Myers and Miller, so the traceback takes linear memory. When only the score matters, myalign_global_score() and myalign_local_score() walk the matrix by anti-diagonals, whose cells the compiler can compute in vector registers.
+
+related files: myalgorithms.h, myalignment.h
 
 A simple example program combining some of the above algorithms is given in mystl_example.cpp
 
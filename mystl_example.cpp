@@ -14,14 +14,14 @@ int main () {
 	//creating a list l and reading the content from stdin
 	mystl::MyVector<std::string> v;
 	while (std::cin >> word && word!="STOP") {
-		v.push_back(word);
+		v.push_back(std::move(word));
     }
 
 	std::cout<<"Seq 2: separate strings with ENTER (end with STOP)"<<std::endl;
 	//creating a vector v containing abcdef as separated chars
 	mystl::MyList<std::string> l;
 	while (std::cin >> word && word!="STOP") {
-        l.push_back(word);
+        l.push_back(std::move(word));
     }
 	
 	//looking for l inside v
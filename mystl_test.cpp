@@ -32,6 +32,52 @@ int main () {
     return collectedresults.wasSuccessful () ? 0 : 1;
 }
 
+///\brief Counts the copies and the live objects of a type
+struct CopyCounter {
+    static int copies;
+    static int alive;
+    int val;
+    CopyCounter(int v=0) : val(v) { ++alive; }
+    CopyCounter(const CopyCounter& other) : val(other.val) { ++copies; ++alive; }
+    CopyCounter(CopyCounter&& other) noexcept : val(other.val) { ++alive; }
+    ~CopyCounter() { --alive; }
+};
+int CopyCounter::copies=0;
+int CopyCounter::alive=0;
+
+///\brief A type whose constructor throws on negative values, its copy throws too when copies is not allowed
+struct Fragile {
+    static bool copies;
+    int val;
+    Fragile(int v) : val(v) { if (v<0) throw std::invalid_argument("Negative value"); }
+    Fragile(const Fragile& other) : val(other.val) { if (!copies) throw std::runtime_error("Copy not allowed"); }
+};
+bool Fragile::copies=true;
+
+///\brief The allocations made through every CountingAllocator, they throw std::bad_alloc once they reach limit
+struct AllocationCounter {
+    static int allocations;
+    static int limit;
+};
+int AllocationCounter::allocations=0;
+int AllocationCounter::limit=INT_MAX;
+
+///\brief An allocator counting the allocations made through it and through its rebound copies
+template<class T>
+struct CountingAllocator : public mystl::MyAllocator<T>, public AllocationCounter {
+    typedef T value_type;
+    CountingAllocator() {}
+    template<class U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+    T* allocate(std::size_t n) {
+        if (allocations>=limit) {
+            throw std::bad_alloc();
+        }
+        ++allocations;
+        return(mystl::MyAllocator<T>::allocate(n));
+    }
+};
+
 ///\brief Testing MyList implementation
 CPPUNIT_TEST_SUITE_REGISTRATION (mylisttest);
 
@@ -65,9 +111,12 @@ void mylisttest :: constructorTest (void) {
     //tests for same content in different objects
     MyList<std::string>::iterator it1 = l.begin();
     MyList<std::string>::iterator it2 = copyl.begin();
-    while (it1++ != l.end() && it2++ != copyl.end()) {
+    //postfix ++ returns the previous position, so the iterators are advanced at the end of the loop
+    while (it1 != l.end() && it2 != copyl.end()) {
         CPPUNIT_ASSERT_EQUAL (*it1, *it2);
         CPPUNIT_ASSERT (it1 != it2);
+        it1++;
+        it2++;
     }
 }
 
@@ -81,9 +130,12 @@ void mylisttest :: assignTest (void) {
     //tests for same content in different objects
     MyList<std::string>::iterator it1 = l.begin();
     MyList<std::string>::iterator it2 = copyl.begin();
-    while (it1++ != l.end() && it2++ != copyl.end()) {
+    //postfix ++ returns the previous position, so the iterators are advanced at the end of the loop
+    while (it1 != l.end() && it2 != copyl.end()) {
         CPPUNIT_ASSERT_EQUAL (*it1, *it2);
         CPPUNIT_ASSERT (it1 != it2);
+        it1++;
+        it2++;
     }
 }
 
@@ -137,6 +189,22 @@ void mylisttest :: iteratorTest (void) {
         inv_str.append(" ");
     }
     CPPUNIT_ASSERT_EQUAL (inv_str, std::string("dieci nove otto sette sei cinque quattro tre due uno zero "));
+
+    //postfix ++ returns the previous position
+    MyList<std::string>::iterator it = l.begin();
+    CPPUNIT_ASSERT_EQUAL (*it++, std::string("zero"));
+    CPPUNIT_ASSERT_EQUAL (*it, std::string("uno"));
+    CPPUNIT_ASSERT_EQUAL (it->size(), static_cast<std::size_t>(3));
+
+    //Standard algorithms on forward iterators
+    const MyList<std::string>::iterator first = l.begin();
+    const MyList<std::string>::iterator last = l.end();
+    CPPUNIT_ASSERT (first!=last);
+    CPPUNIT_ASSERT_EQUAL (std::distance(first,last), static_cast<std::ptrdiff_t>(11));
+    CPPUNIT_ASSERT_EQUAL (*std::max_element(first,last), std::string("zero"));
+    std::vector<std::string> copy;
+    std::copy(first,last,std::back_inserter(copy));
+    CPPUNIT_ASSERT (std::equal(copy.begin(),copy.end(),l.begin()));
 }
 
 ///Tests reverse_iterator class
@@ -162,6 +230,329 @@ void mylisttest :: exceptionTest (void) {
     CPPUNIT_ASSERT_THROW (emptyl.back(), std::out_of_range);
 }
 
+///Tests emplace_front() emplace_back() and the rvalue push overloads
+void mylisttest :: emplaceTest (void) {
+    l.emplace_back(3,'x');
+    CPPUNIT_ASSERT_EQUAL (l.back(), std::string("xxx"));
+    l.emplace_front("menouno");
+    CPPUNIT_ASSERT_EQUAL (l.front(), std::string("menouno"));
+    CPPUNIT_ASSERT_EQUAL (l.size(), 13);
+
+    CopyCounter::copies=0;
+    mystl::MyList<CopyCounter> cl;
+    cl.emplace_back(1);
+    cl.emplace_front(0);
+    cl.push_back(CopyCounter(2));
+    cl.push_front(CopyCounter(-1));
+    //values are built directly inside the nodes
+    CPPUNIT_ASSERT_EQUAL (CopyCounter::copies, 0);
+    CPPUNIT_ASSERT_EQUAL ((*cl.begin()).val, -1);
+    CPPUNIT_ASSERT_EQUAL ((*cl.rbegin()).val, 2);
+}
+
+///Tests reserve_nodes() and the recycling of deleted elements
+void mylisttest :: slabTest (void) {
+    typedef mystl::MyList<int,CountingAllocator<int> > Tlist;
+    Tlist cl;
+    cl.reserve_nodes(1000);
+    const int allocations=CountingAllocator<int>::allocations;
+    for (int i=0; i<1000; ++i) {
+        cl.push_back(i);
+    }
+    CPPUNIT_ASSERT_EQUAL (CountingAllocator<int>::allocations, allocations);
+
+    //elements inserted one after the other are contiguous
+    Tlist::iterator it=cl.begin();
+    int* first=&*it;
+    int* second=&*(++it);
+    int* third=&*(++it);
+    CPPUNIT_ASSERT (second>first);
+    CPPUNIT_ASSERT (third-second==second-first);
+
+    //deleted elements are recycled
+    cl.pop_front();
+    cl.push_front(-1);
+    CPPUNIT_ASSERT (&*cl.begin()==first);
+    cl.clear();
+    for (int i=0; i<1000; ++i) {
+        cl.push_front(i);
+    }
+    CPPUNIT_ASSERT_EQUAL (CountingAllocator<int>::allocations, allocations);
+    CPPUNIT_ASSERT_EQUAL (cl.front(), 999);
+}
+
+///\brief Joins the elements of a sequence separated by spaces
+template<class In>
+std::string join(In first, In last) {
+    std::ostringstream str;
+    while (first!=last) {
+        str << *first << " ";
+        ++first;
+    }
+    return(str.str());
+}
+
+///Tests that deleting a very long list does not exhaust the stack
+void mylisttest :: teardownTest (void) {
+    mystl::MyList<int>* longl = new mystl::MyList<int>;
+    for (int i=0; i<2000000; ++i) {
+        longl->push_back(i);
+    }
+    longl->clear();
+    CPPUNIT_ASSERT (longl->empty());
+    for (int i=0; i<2000000; ++i) {
+        longl->push_front(i);
+    }
+    delete longl;
+}
+
+///Tests swap()
+void mylisttest :: swapTest (void) {
+    MyList<std::string>::iterator it = l.begin();
+    l.swap(emptyl);
+    CPPUNIT_ASSERT (l.empty());
+    CPPUNIT_ASSERT_EQUAL (emptyl.size(), 11);
+    //iterators follow the elements
+    CPPUNIT_ASSERT (it==emptyl.begin());
+    swap(l,emptyl);
+    CPPUNIT_ASSERT_EQUAL (l.front(), std::string("zero"));
+    CPPUNIT_ASSERT (emptyl.empty());
+}
+
+///Tests the splice() methods
+void mylisttest :: spliceTest (void) {
+    mystl::MyList<int> a;
+    mystl::MyList<int> b;
+    for (int i=0; i<5; ++i) {
+        a.push_back(i);
+        b.push_back(10+i);
+    }
+    int* moved=&*b.begin();
+
+    //whole list: elements are relinked, not copied
+    a.splice(myfind(a.begin(),a.end(),2),b);
+    CPPUNIT_ASSERT (b.empty());
+    CPPUNIT_ASSERT_EQUAL (a.size(), 10);
+    CPPUNIT_ASSERT_EQUAL (join(a.begin(),a.end()), std::string("0 1 10 11 12 13 14 2 3 4 "));
+    CPPUNIT_ASSERT (&*myfind(a.begin(),a.end(),10)==moved);
+    b.push_back(20);
+    b.splice(b.end(),a);
+    CPPUNIT_ASSERT_EQUAL (join(b.begin(),b.end()), std::string("20 0 1 10 11 12 13 14 2 3 4 "));
+    CPPUNIT_ASSERT_EQUAL (join(b.rbegin(),b.rend()), std::string("4 3 2 14 13 12 11 10 1 0 20 "));
+    a.swap(b);
+
+    //inside the same list
+    a.splice(a.begin(),a,myfind(a.begin(),a.end(),4));
+    CPPUNIT_ASSERT_EQUAL (join(a.begin(),a.end()), std::string("4 20 0 1 10 11 12 13 14 2 3 "));
+    a.splice(a.end(),a,myfind(a.begin(),a.end(),10),myfind(a.begin(),a.end(),2));
+    CPPUNIT_ASSERT_EQUAL (join(a.begin(),a.end()), std::string("4 20 0 1 2 3 10 11 12 13 14 "));
+    CPPUNIT_ASSERT_EQUAL (join(a.rbegin(),a.rend()), std::string("14 13 12 11 10 3 2 1 0 20 4 "));
+    CPPUNIT_ASSERT_EQUAL (a.size(), 11);
+
+    //between lists
+    b.splice(b.begin(),a,a.begin());
+    b.splice(b.end(),a,myfind(a.begin(),a.end(),10),a.end());
+    CPPUNIT_ASSERT_EQUAL (join(b.begin(),b.end()), std::string("4 10 11 12 13 14 "));
+    CPPUNIT_ASSERT_EQUAL (join(a.begin(),a.end()), std::string("20 0 1 2 3 "));
+    CPPUNIT_ASSERT_EQUAL (a.size(), 5);
+    CPPUNIT_ASSERT_EQUAL (b.size(), 6);
+    CPPUNIT_ASSERT_EQUAL (a.back(), 3);
+
+    //elements spliced from another list keep their storage, even after that list is gone
+    mystl::MyList<std::string>* source = new mystl::MyList<std::string>;
+    source->push_back("zero");
+    source->push_back("uno");
+    source->push_back("due");
+    std::string* uno=&*(++source->begin());
+    mystl::MyList<std::string> target;
+    target.splice(target.end(),*source,++source->begin());
+    target.splice(target.begin(),*source,source->begin(),source->end());
+    CPPUNIT_ASSERT (&*myfind(target.begin(),target.end(),std::string("uno"))==uno);
+    CPPUNIT_ASSERT_EQUAL (source->size(), 0);
+    CPPUNIT_ASSERT_EQUAL (target.size(), 3);
+    delete source;
+    CPPUNIT_ASSERT_EQUAL (join(target.begin(),target.end()), std::string("zero due uno "));
+    target.pop_front();
+    target.clear();
+
+    //the slots of the elements deleted by another list are reused by the one that created them
+    typedef mystl::MyList<int,CountingAllocator<int> > Tlist;
+    Tlist producer;
+    Tlist consumer;
+    producer.reserve_nodes(100);
+    const int allocations=CountingAllocator<int>::allocations;
+    for (int round=0; round<50; ++round) {
+        for (int i=0; i<100; ++i) {
+            producer.push_back(i);
+        }
+        consumer.splice(consumer.end(),producer,producer.begin(),producer.end());
+        consumer.clear();
+    }
+    CPPUNIT_ASSERT_EQUAL (CountingAllocator<int>::allocations, allocations);
+}
+
+///Tests the merge() methods
+void mylisttest :: mergeTest (void) {
+    mystl::MyList<int> a;
+    mystl::MyList<int> b;
+    for (int i=0; i<10; i+=2) {
+        a.push_back(i);
+        b.push_back(i+1);
+    }
+    b.push_back(20);
+    a.merge(b);
+    CPPUNIT_ASSERT (b.empty());
+    CPPUNIT_ASSERT_EQUAL (a.size(), 11);
+    CPPUNIT_ASSERT_EQUAL (join(a.begin(),a.end()), std::string("0 1 2 3 4 5 6 7 8 9 20 "));
+    CPPUNIT_ASSERT_EQUAL (join(a.rbegin(),a.rend()), std::string("20 9 8 7 6 5 4 3 2 1 0 "));
+
+    //with a comparator
+    mystl::MyList<int> c;
+    c.push_back(30);
+    c.push_back(-1);
+    b.push_back(25);
+    b.push_back(0);
+    c.merge(b,std::greater<int>());
+    CPPUNIT_ASSERT_EQUAL (join(c.begin(),c.end()), std::string("30 25 0 -1 "));
+
+    //the elements of the merged list survive it
+    {
+        mystl::MyList<int> d;
+        d.push_back(100);
+        a.merge(d);
+    }
+    CPPUNIT_ASSERT_EQUAL (a.back(), 100);
+}
+
+///\brief Orders pairs by their first member only
+struct FirstLess {
+    bool operator()(const std::pair<int,int>& a, const std::pair<int,int>& b) const {
+        return(a.first<b.first);
+    }
+};
+
+///Tests the sort() methods
+void mylisttest :: sortTest (void) {
+    l.sort();
+    CPPUNIT_ASSERT_EQUAL (join(l.begin(),l.end()), std::string("cinque dieci due nove otto quattro sei sette tre uno zero "));
+    CPPUNIT_ASSERT_EQUAL (join(l.rbegin(),l.rend()), std::string("zero uno tre sette sei quattro otto nove due dieci cinque "));
+    CPPUNIT_ASSERT_EQUAL (l.size(), 11);
+    CPPUNIT_ASSERT_EQUAL (l.back(), std::string("zero"));
+
+    //values are not moved around: the elements are relinked
+    mystl::MyList<int> il;
+    std::vector<int> sorted;
+    for (int i=0; i<1000; ++i) {
+        const int val=(i*7919)%1009;
+        il.push_back(val);
+        sorted.push_back(val);
+    }
+    int* first=&*il.begin();
+    il.sort();
+    std::sort(sorted.begin(),sorted.end());
+    CPPUNIT_ASSERT (myequal(sorted.begin(),sorted.end(),il.begin()));
+    CPPUNIT_ASSERT_EQUAL (*myfind(il.begin(),il.end(),0), 0);
+    CPPUNIT_ASSERT (&*myfind(il.begin(),il.end(),0)==first);
+
+    //the sort is stable
+    mystl::MyList<std::pair<int,int> > pl;
+    for (int i=0; i<100; ++i) {
+        pl.push_back(std::make_pair(i%3,i));
+    }
+    pl.sort(FirstLess());
+    std::pair<int,int> prev=pl.front();
+    for (MyList<std::pair<int,int> >::iterator it=++pl.begin(); it!=pl.end(); ++it) {
+        CPPUNIT_ASSERT (prev.first<(*it).first || (prev.first==(*it).first && prev.second<(*it).second));
+        prev=*it;
+    }
+
+    emptyl.sort();
+    CPPUNIT_ASSERT (emptyl.empty());
+}
+
+///\brief Tells if an int is even
+bool is_even(int n) {
+    return(n%2==0);
+}
+
+///Tests unique() and remove_if()
+void mylisttest :: uniqueTest (void) {
+    mystl::MyList<int> il;
+    const int vals[] = {1,1,2,3,3,3,4,1,1};
+    for (int i=0; i<9; ++i) {
+        il.push_back(vals[i]);
+    }
+    il.unique();
+    CPPUNIT_ASSERT_EQUAL (join(il.begin(),il.end()), std::string("1 2 3 4 1 "));
+    CPPUNIT_ASSERT_EQUAL (il.size(), 5);
+    il.remove_if(is_even);
+    CPPUNIT_ASSERT_EQUAL (join(il.begin(),il.end()), std::string("1 3 1 "));
+    CPPUNIT_ASSERT_EQUAL (join(il.rbegin(),il.rend()), std::string("1 3 1 "));
+    il.unique(std::less<int>());
+    CPPUNIT_ASSERT_EQUAL (join(il.begin(),il.end()), std::string("1 1 "));
+    il.remove_if([](int n) { return(n==1); });
+    CPPUNIT_ASSERT (il.empty());
+    CPPUNIT_ASSERT_THROW (il.back(), std::out_of_range);
+}
+
+///Tests save() and load()
+void mylisttest :: saveTest (void) {
+    std::stringstream buf;
+    l.save(buf);
+    mystl::MyList<std::string> loaded;
+    loaded.push_back("old");
+    loaded.load(buf);
+    CPPUNIT_ASSERT_EQUAL (join(loaded.begin(),loaded.end()), join(l.begin(),l.end()));
+
+    //lists and vectors share the format
+    mystl::MyVector<int> v;
+    for (int i=0; i<100; ++i) {
+        v.push_back(i);
+    }
+    std::stringstream ibuf;
+    v.save(ibuf);
+    mystl::MyList<int> il;
+    il.load(ibuf);
+    CPPUNIT_ASSERT_EQUAL (il.size(), 100);
+    CPPUNIT_ASSERT_EQUAL (il.back(), 99);
+
+    std::stringstream wrong;
+    il.save(wrong);
+    CPPUNIT_ASSERT_THROW (loaded.load(wrong), std::runtime_error);
+    CPPUNIT_ASSERT (loaded.empty());
+
+    //a corrupted count fails at the end of the input instead of reserving it
+    std::stringstream corrupt;
+    mystl::mywrite_header<int>(corrupt, 2147483647);
+    mystl::MySerializer<int>::write(corrupt, 1);
+    CPPUNIT_ASSERT_THROW (il.load(corrupt), std::runtime_error);
+    CPPUNIT_ASSERT (il.empty());
+
+    //running out of memory halfway fails instead of loading part of the list
+    for (int i=100; i<100000; ++i) {
+        v.push_back(i);
+    }
+    std::stringstream big;
+    v.save(big);
+    typedef mystl::MyList<int,CountingAllocator<int> > Tlist;
+    int before=CountingAllocator<int>::allocations;
+    {
+        Tlist full;
+        full.load(big);
+        CPPUNIT_ASSERT_EQUAL (full.size(), 100000);
+    }
+    const int needed=CountingAllocator<int>::allocations-before;
+    CPPUNIT_ASSERT (needed>2);
+    big.clear();
+    big.seekg(0);
+    Tlist partial;
+    before=CountingAllocator<int>::allocations;
+    CountingAllocator<int>::limit=before+needed-1;
+    CPPUNIT_ASSERT_THROW (partial.load(big), std::bad_alloc);
+    CountingAllocator<int>::limit=INT_MAX;
+    CPPUNIT_ASSERT (partial.empty());
+}
+
 ///brief Testing MyVector implementation
 CPPUNIT_TEST_SUITE_REGISTRATION (myvectortest);
 
@@ -194,9 +585,12 @@ void myvectortest :: constructorTest (void) {
     //tests for same content in different objects
     MyVector<std::string>::iterator it1 = v.begin();
     MyVector<std::string>::iterator it2 = copyv.begin();
-    while (it1++ != v.end() && it2++ != copyv.end()) {
+    //postfix ++ returns the previous position, so the iterators are advanced at the end of the loop
+    while (it1 != v.end() && it2 != copyv.end()) {
         CPPUNIT_ASSERT_EQUAL (*it1, *it2);
         CPPUNIT_ASSERT (it1 != it2);
+        it1++;
+        it2++;
     }
 }
 
@@ -210,9 +604,12 @@ void myvectortest :: assignTest (void) {
     //tests for same content in different objects
     MyVector<std::string>::iterator it1 = v.begin();
     MyVector<std::string>::iterator it2 = copyv.begin();
-    while (it1++ != v.end() && it2++ != copyv.end()) {
+    //postfix ++ returns the previous position, so the iterators are advanced at the end of the loop
+    while (it1 != v.end() && it2 != copyv.end()) {
         CPPUNIT_ASSERT_EQUAL (*it1, *it2);
         CPPUNIT_ASSERT (it1 != it2);
+        it1++;
+        it2++;
     }
 }
 
@@ -224,14 +621,28 @@ void myvectortest :: emptyTest (void) {
     CPPUNIT_ASSERT (v.empty());
 }
 
-///Tests size() reserve() and capacity() methods
+///Tests size() reserve() resize() and capacity() methods
 void myvectortest :: sizeTest (void) {
-    CPPUNIT_ASSERT_EQUAL (v.size(), 11);
+    CPPUNIT_ASSERT_EQUAL (v.size(), static_cast<std::size_t>(11));
     v.push_back("undici");
-    CPPUNIT_ASSERT_EQUAL (v.size(), 12);
+    CPPUNIT_ASSERT_EQUAL (v.size(), static_cast<std::size_t>(12));
     CPPUNIT_ASSERT (v.capacity()>=v.size());
     v.reserve(30);
     CPPUNIT_ASSERT (v.capacity()>=30);
+
+    v.resize(3);
+    CPPUNIT_ASSERT_EQUAL (join(v.begin(),v.end()), std::string("zero uno due "));
+    v.resize(5);
+    CPPUNIT_ASSERT_EQUAL (v.size(), static_cast<std::size_t>(5));
+    CPPUNIT_ASSERT (v[4].empty());
+    //the value may be an element of the vector itself
+    v.resize(100,v[1]);
+    CPPUNIT_ASSERT_EQUAL (v.size(), static_cast<std::size_t>(100));
+    CPPUNIT_ASSERT_EQUAL (v[99], std::string("uno"));
+
+    mystl::MyVector<int> iv;
+    iv.resize(4);
+    CPPUNIT_ASSERT_EQUAL (join(iv.begin(),iv.end()), std::string("0 0 0 0 "));
 }
 
 ///Tests front() method ad operator[]
@@ -269,6 +680,11 @@ void myvectortest :: reverse_iteratorTest (void) {
         str.append(" ");
     }
     CPPUNIT_ASSERT_EQUAL (str, std::string("dieci nove otto sette sei cinque quattro tre due uno zero "));
+
+    //an empty vector has no storage, its reverse range is empty
+    CPPUNIT_ASSERT (emptyv.rbegin()==emptyv.rend());
+    CPPUNIT_ASSERT (emptyv.crbegin()==emptyv.crend());
+    CPPUNIT_ASSERT (v.rbegin().base()==v.data()+v.size());
 }
 
 ///Test exceptional behaviour
@@ -278,6 +694,1383 @@ void myvectortest :: exceptionTest (void) {
     CPPUNIT_ASSERT_THROW (emptyv.pop_back(), std::out_of_range);
 }
 
+///Tests the random access operators of iterator and the Standard algorithms on it
+void myvectortest :: random_accessTest (void) {
+    MyVector<std::string>::iterator it = v.begin();
+    CPPUNIT_ASSERT_EQUAL (*(it+3), std::string("tre"));
+    CPPUNIT_ASSERT_EQUAL (it[5], std::string("cinque"));
+    CPPUNIT_ASSERT_EQUAL (v.end()-v.begin(), static_cast<std::ptrdiff_t>(v.size()));
+    CPPUNIT_ASSERT_EQUAL (*(2+it), std::string("due"));
+    it+=10;
+    CPPUNIT_ASSERT_EQUAL (*it, std::string("dieci"));
+    it-=4;
+    CPPUNIT_ASSERT_EQUAL (*(it--), std::string("sei"));
+    CPPUNIT_ASSERT_EQUAL (*it, std::string("cinque"));
+    CPPUNIT_ASSERT (v.begin()<it && it<=v.end() && v.end()>it && it>=it);
+    CPPUNIT_ASSERT_EQUAL (it->size(), static_cast<std::size_t>(6));
+
+    //iterator_traits sees a random access iterator
+    typedef std::iterator_traits<MyVector<std::string>::iterator> Ttraits;
+    CPPUNIT_ASSERT ((std::is_same<Ttraits::iterator_category, std::random_access_iterator_tag>::value));
+    CPPUNIT_ASSERT_EQUAL (std::distance(v.begin(),v.end()), static_cast<std::ptrdiff_t>(11));
+
+    std::sort(v.begin(),v.end());
+    CPPUNIT_ASSERT_EQUAL (join(v.begin(),v.end()), std::string("cinque dieci due nove otto quattro sei sette tre uno zero "));
+    CPPUNIT_ASSERT (std::binary_search(v.begin(),v.end(),std::string("sette")));
+    CPPUNIT_ASSERT (std::lower_bound(v.begin(),v.end(),std::string("otto"))-v.begin()==4);
+
+    MyVector<std::string>::reverse_iterator rit = v.rbegin();
+    CPPUNIT_ASSERT_EQUAL (rit[1], std::string("uno"));
+    CPPUNIT_ASSERT_EQUAL (*(rit+10), std::string("cinque"));
+    CPPUNIT_ASSERT_EQUAL (v.rend()-v.rbegin(), static_cast<std::ptrdiff_t>(11));
+    std::sort(v.rbegin(),v.rend());
+    CPPUNIT_ASSERT_EQUAL (v.front(), std::string("zero"));
+}
+
+///Tests const_iterator and const_reverse_iterator classes
+void myvectortest :: const_iteratorTest (void) {
+    const mystl::MyVector<std::string>& cv = v;
+    std::string str;
+    for (MyVector<std::string>::const_iterator it = cv.begin(); it != cv.end(); ++it) {
+        str.append(*it);
+        str.append(" ");
+    }
+    CPPUNIT_ASSERT_EQUAL (str, std::string("zero uno due tre quattro cinque sei sette otto nove dieci "));
+    CPPUNIT_ASSERT_EQUAL (join(v.crbegin(),v.crend()), std::string("dieci nove otto sette sei cinque quattro tre due uno zero "));
+    CPPUNIT_ASSERT_EQUAL (cv[1], std::string("uno"));
+
+    //an iterator converts to a const_iterator and they compare
+    MyVector<std::string>::const_iterator cit = v.begin();
+    CPPUNIT_ASSERT (cit==v.begin() && v.begin()==cit);
+    CPPUNIT_ASSERT (v.cend()-cit==11);
+    CPPUNIT_ASSERT (myfind(v.cbegin(),v.cend(),std::string("sei"))==v.begin()+6);
+}
+
+///Tests emplace_back() and the rvalue push_back overload
+void myvectortest :: emplaceTest (void) {
+    v.emplace_back(3,'x');
+    CPPUNIT_ASSERT_EQUAL (v.back(), std::string("xxx"));
+    //an element of the vector itself can be inserted while it grows
+    while (v.size()<v.capacity()) {
+        v.push_back("riempitivo");
+    }
+    v.push_back(v[0]);
+    CPPUNIT_ASSERT_EQUAL (v.back(), std::string("zero"));
+
+    CopyCounter::copies=0;
+    mystl::MyVector<CopyCounter> cv(1);
+    cv.emplace_back(1);
+    cv.push_back(CopyCounter(2));
+    cv.emplace_back(3);
+    //values are built directly inside the vector
+    CPPUNIT_ASSERT_EQUAL (CopyCounter::copies, 0);
+    CPPUNIT_ASSERT_EQUAL (cv[1].val, 2);
+}
+
+///Tests move constructor and move assignment
+void myvectortest :: moveTest (void) {
+    mystl::MyVector<std::string> movedv(std::move(v));
+    CPPUNIT_ASSERT (v.empty());
+    CPPUNIT_ASSERT_EQUAL (movedv.size(), static_cast<std::size_t>(11));
+    CPPUNIT_ASSERT_EQUAL (movedv[10], std::string("dieci"));
+
+    mystl::MyVector<std::string> assignedv;
+    assignedv.push_back("element to be erased");
+    assignedv=std::move(movedv);
+    CPPUNIT_ASSERT (movedv.empty());
+    CPPUNIT_ASSERT_EQUAL (assignedv.size(), static_cast<std::size_t>(11));
+    CPPUNIT_ASSERT_EQUAL (assignedv.front(), std::string("zero"));
+
+    //a moved-from vector can be reused
+    movedv.push_back("uno");
+    CPPUNIT_ASSERT_EQUAL (movedv.back(), std::string("uno"));
+}
+
+///Tests that growth relocates elements without copying them
+void myvectortest :: growthTest (void) {
+    CopyCounter::copies=0;
+    CopyCounter::alive=0;
+    {
+        mystl::MyVector<CopyCounter> cv(1);
+        //no element is built by the constructor nor by reserve
+        CPPUNIT_ASSERT_EQUAL (CopyCounter::alive, 0);
+        CopyCounter val(7);
+        for (int i=0; i<100; ++i) {
+            cv.push_back(val);
+        }
+        //one copy per push_back, none during the reallocations
+        CPPUNIT_ASSERT_EQUAL (CopyCounter::copies, 100);
+        CPPUNIT_ASSERT_EQUAL (CopyCounter::alive, 101);
+        cv.pop_back();
+        CPPUNIT_ASSERT_EQUAL (CopyCounter::alive, 100);
+    }
+    CPPUNIT_ASSERT_EQUAL (CopyCounter::alive, 0);
+}
+
+///Tests the bytewise copy and the in place growth of trivially copyable elements
+void myvectortest :: trivialTest (void) {
+    mystl::MyVector<int> iv(1);
+    for (int i=0; i<100000; ++i) {
+        iv.push_back(i);
+    }
+    //the new element may alias the buffer being resized
+    iv.reserve(iv.size());
+    while (iv.size()<iv.capacity()) {
+        iv.push_back(static_cast<int>(iv.size()));
+    }
+    iv.push_back(iv[0]);
+    for (std::size_t i=0; i<iv.size()-1; ++i) {
+        CPPUNIT_ASSERT_EQUAL (iv[i], static_cast<int>(i));
+    }
+    CPPUNIT_ASSERT_EQUAL (iv.back(), 0);
+
+    mystl::MyVector<double> dv;
+    dv.push_back(0.5);
+    dv.push_back(1.5);
+    mystl::MyVector<double> dcopy(dv);
+    CPPUNIT_ASSERT_EQUAL (dcopy.size(), static_cast<std::size_t>(2));
+    CPPUNIT_ASSERT_EQUAL (dcopy[1], 1.5);
+    dcopy.push_back(2.5);
+    dcopy = dv;
+    CPPUNIT_ASSERT_EQUAL (dcopy.size(), static_cast<std::size_t>(2));
+    CPPUNIT_ASSERT_EQUAL (dcopy[0], 0.5);
+
+    //the last allocation of an arena grows without moving
+    mystl::MyArena arena(4096);
+    typedef mystl::MyArenaAllocator<int> Ialloc;
+    mystl::MyVector<int,Ialloc> av(4,Ialloc(arena));
+    for (int i=0; i<4; ++i) {
+        av.push_back(i);
+    }
+    const int* first = &av[0];
+    av.push_back(4);
+    av.reserve(100);
+    CPPUNIT_ASSERT (&av[0]==first);
+    for (std::size_t i=0; i<av.size(); ++i) {
+        CPPUNIT_ASSERT_EQUAL (av[i], static_cast<int>(i));
+    }
+
+    //an inline buffer is never handed to the allocator
+    mystl::MySmallVector<int,4> sv;
+    for (int i=0; i<20; ++i) {
+        sv.push_back(i);
+    }
+    CPPUNIT_ASSERT (!sv.is_inline());
+    CPPUNIT_ASSERT_EQUAL (sv[19], 19);
+}
+
+///Tests the growth policies
+void myvectortest :: policyTest (void) {
+    //an empty vector owns no storage
+    mystl::MyVector<int> iv;
+    CPPUNIT_ASSERT_EQUAL (iv.capacity(), static_cast<std::size_t>(0));
+    iv.push_back(1);
+    CPPUNIT_ASSERT_EQUAL (iv.capacity(), static_cast<std::size_t>(10));
+    CPPUNIT_ASSERT_THROW (iv.reserve(iv.max_size()+1), std::length_error);
+
+    mystl::MyVector<int,mystl::MyAllocator<int>,mystl::MyHalfGrowth> hv;
+    const std::size_t half[] = {2, 2, 3, 4, 6, 6, 9};
+    for (int i=0; i<7; ++i) {
+        hv.push_back(i);
+        CPPUNIT_ASSERT_EQUAL (hv.capacity(), half[i]);
+    }
+
+    mystl::MyVector<std::string,mystl::MyAllocator<std::string>,mystl::MyChunkGrowth<4> > cv;
+    for (int i=0; i<9; ++i) {
+        cv.push_back("chunk");
+    }
+    CPPUNIT_ASSERT_EQUAL (cv.capacity(), static_cast<std::size_t>(12));
+    CPPUNIT_ASSERT_EQUAL (cv[8], std::string("chunk"));
+
+    mystl::MySmallVector<int,2,mystl::MyAllocator<int>,mystl::MyChunkGrowth<3> > sv;
+    for (int i=0; i<3; ++i) {
+        sv.push_back(i);
+    }
+    CPPUNIT_ASSERT_EQUAL (sv.capacity(), static_cast<std::size_t>(5));
+}
+
+///Tests shrink_to_fit() method
+void myvectortest :: shrinkTest (void) {
+    v.reserve(100);
+    v.shrink_to_fit();
+    CPPUNIT_ASSERT_EQUAL (v.capacity(), v.size());
+    CPPUNIT_ASSERT_EQUAL (v[v.size()-1], std::string("dieci"));
+
+    mystl::MyVector<int> iv(50);
+    iv.push_back(3);
+    iv.shrink_to_fit();
+    CPPUNIT_ASSERT_EQUAL (iv.capacity(), static_cast<std::size_t>(1));
+    CPPUNIT_ASSERT_EQUAL (iv[0], 3);
+    iv.pop_back();
+    iv.shrink_to_fit();
+    CPPUNIT_ASSERT_EQUAL (iv.capacity(), static_cast<std::size_t>(0));
+    iv.push_back(4);
+    CPPUNIT_ASSERT_EQUAL (iv.back(), 4);
+
+    //elements that fit the inline buffer move back there
+    mystl::MySmallVector<std::string,4> sv;
+    for (int i=0; i<10; ++i) {
+        sv.push_back("small");
+    }
+    while (sv.size()>3) {
+        sv.pop_back();
+    }
+    sv.shrink_to_fit();
+    CPPUNIT_ASSERT (sv.is_inline());
+    CPPUNIT_ASSERT_EQUAL (sv.capacity(), static_cast<std::size_t>(4));
+    CPPUNIT_ASSERT_EQUAL (sv[2], std::string("small"));
+}
+
+///Tests the range constructor and assign()
+void myvectortest :: rangeTest (void) {
+    mystl::MyVector<std::string> copyv(v.begin(),v.end());
+    CPPUNIT_ASSERT_EQUAL (copyv.size(), v.size());
+    CPPUNIT_ASSERT_EQUAL (copyv.capacity(), v.size());
+    CPPUNIT_ASSERT (std::equal(copyv.begin(),copyv.end(),v.begin()));
+
+    //a list is measured before copying
+    mystl::MyList<std::string> l;
+    l.push_back("a");
+    l.push_back("b");
+    copyv.assign(l.begin(),l.end());
+    CPPUNIT_ASSERT_EQUAL (join(copyv.begin(),copyv.end()), std::string("a b "));
+
+    //an input stream is read one element at a time
+    std::istringstream in("1 2 3");
+    mystl::MyVector<int> iv((std::istream_iterator<int>(in)), std::istream_iterator<int>());
+    CPPUNIT_ASSERT_EQUAL (join(iv.begin(),iv.end()), std::string("1 2 3 "));
+
+    const int a[] = {4, 5};
+    iv.assign(a,a+2);
+    CPPUNIT_ASSERT_EQUAL (join(iv.begin(),iv.end()), std::string("4 5 "));
+    iv.assign(a,a);
+    CPPUNIT_ASSERT (iv.empty());
+}
+
+///Tests insert() of a range
+void myvectortest :: insertTest (void) {
+    const std::string words[] = {"a", "b", "c"};
+    //the new elements are built in a larger buffer
+    mystl::MyVector<std::string>::iterator it = v.insert(v.begin()+1, words, words+3);
+    CPPUNIT_ASSERT_EQUAL (*it, std::string("a"));
+    CPPUNIT_ASSERT_EQUAL (join(v.begin(),v.begin()+5), std::string("zero a b c uno "));
+    CPPUNIT_ASSERT_EQUAL (v.size(), static_cast<std::size_t>(14));
+
+    //fewer elements follow pos than are inserted
+    v.reserve(100);
+    v.insert(v.end()-1, words, words+3);
+    CPPUNIT_ASSERT_EQUAL (join(v.end()-5,v.end()), std::string("nove a b c dieci "));
+    //more elements follow pos than are inserted
+    v.insert(v.begin(), words, words+2);
+    CPPUNIT_ASSERT_EQUAL (join(v.begin(),v.begin()+4), std::string("a b zero a "));
+    CPPUNIT_ASSERT_EQUAL (v.size(), static_cast<std::size_t>(19));
+    CPPUNIT_ASSERT_EQUAL (v.back(), std::string("dieci"));
+
+    mystl::MyVector<int> iv;
+    const int a[] = {1, 2, 3};
+    iv.insert(iv.end(), a, a+3);
+    iv.insert(iv.begin()+1, a, a+3);
+    CPPUNIT_ASSERT_EQUAL (join(iv.begin(),iv.end()), std::string("1 1 2 3 2 3 "));
+    std::istringstream in("8 9");
+    iv.insert(iv.begin()+2, std::istream_iterator<int>(in), std::istream_iterator<int>());
+    CPPUNIT_ASSERT_EQUAL (join(iv.begin(),iv.end()), std::string("1 1 8 9 2 3 2 3 "));
+}
+
+///Tests erase() methods
+void myvectortest :: eraseTest (void) {
+    mystl::MyVector<std::string>::iterator it = v.erase(v.begin()+1, v.begin()+9);
+    CPPUNIT_ASSERT_EQUAL (*it, std::string("nove"));
+    CPPUNIT_ASSERT_EQUAL (join(v.begin(),v.end()), std::string("zero nove dieci "));
+    it = v.erase(v.begin());
+    CPPUNIT_ASSERT_EQUAL (*it, std::string("nove"));
+    it = v.erase(v.begin()+1, v.end());
+    CPPUNIT_ASSERT (it==v.end());
+    CPPUNIT_ASSERT_EQUAL (v.size(), static_cast<std::size_t>(1));
+
+    mystl::MyVector<int> iv;
+    iv.resize(5,7);
+    iv[4]=8;
+    iv.erase(iv.begin(), iv.begin()+3);
+    CPPUNIT_ASSERT_EQUAL (join(iv.begin(),iv.end()), std::string("7 8 "));
+    iv.erase(iv.begin(), iv.begin());
+    CPPUNIT_ASSERT_EQUAL (iv.size(), static_cast<std::size_t>(2));
+}
+
+///Tests save() and load()
+void myvectortest :: saveTest (void) {
+    std::stringstream buf;
+    v.save(buf);
+    mystl::MyVector<std::string> loaded;
+    loaded.load(buf);
+    CPPUNIT_ASSERT_EQUAL (loaded.size(), v.size());
+    CPPUNIT_ASSERT_EQUAL (loaded.capacity(), v.size());
+    CPPUNIT_ASSERT (std::equal(loaded.begin(),loaded.end(),v.begin()));
+
+    //raw elements are one block after the header
+    mystl::MyVector<double> dv;
+    dv.push_back(0.5);
+    dv.push_back(1.5);
+    std::stringstream dbuf;
+    dv.save(dbuf);
+    CPPUNIT_ASSERT_EQUAL (dbuf.str().size(), static_cast<std::size_t>(32+2*sizeof(double)));
+    mystl::MyVector<double> dloaded;
+    dloaded.load(dbuf);
+    CPPUNIT_ASSERT_EQUAL (dloaded[1], 1.5);
+
+    //a truncated input leaves the vector empty
+    std::stringstream cut(dbuf.str().substr(0,dbuf.str().size()-1));
+    CPPUNIT_ASSERT_THROW (dloaded.load(cut), std::runtime_error);
+    CPPUNIT_ASSERT (dloaded.empty());
+    std::stringstream text("zero uno due");
+    CPPUNIT_ASSERT_THROW (loaded.load(text), std::runtime_error);
+    std::stringstream wrong(buf.str());
+    CPPUNIT_ASSERT_THROW (dloaded.load(wrong), std::runtime_error);
+
+    //a corrupted count fails at the end of the input instead of allocating it
+    std::stringstream corrupt;
+    mystl::mywrite_header<double>(corrupt, static_cast<std::size_t>(1000000000000ULL));
+    mystl::MySerializer<double>::write(corrupt, 0.5);
+    CPPUNIT_ASSERT_THROW (dloaded.load(corrupt), std::runtime_error);
+    CPPUNIT_ASSERT (dloaded.empty());
+
+    //a vector larger than a chunk is read a chunk at a time
+    mystl::MyVector<int> large;
+    for (int i=0; i<1000000; ++i) {
+        large.push_back(i);
+    }
+    std::stringstream lbuf;
+    large.save(lbuf);
+    mystl::MyVector<int> lloaded;
+    lloaded.load(lbuf);
+    CPPUNIT_ASSERT_EQUAL (lloaded.size(), large.size());
+    CPPUNIT_ASSERT (std::equal(lloaded.begin(),lloaded.end(),large.begin()));
+}
+
+///Tests the aligned storage, the padding of the capacity and data()
+void myvectortest :: alignTest (void) {
+    CPPUNIT_ASSERT (v.data()==&v[0]);
+    const mystl::MyVector<std::string>& cv = v;
+    CPPUNIT_ASSERT_EQUAL (cv.data()[10], std::string("dieci"));
+
+    //8 floats fill 32 bytes
+    mystl::MyAlignedVector<float,32> fv;
+    for (int i=0; i<3; ++i) {
+        fv.push_back(i);
+    }
+    CPPUNIT_ASSERT (reinterpret_cast<std::size_t>(fv.data())%32==0);
+    CPPUNIT_ASSERT_EQUAL (fv.capacity(), static_cast<std::size_t>(16));
+    fv.reserve(17);
+    CPPUNIT_ASSERT_EQUAL (fv.capacity(), static_cast<std::size_t>(24));
+    CPPUNIT_ASSERT (reinterpret_cast<std::size_t>(fv.data())%32==0);
+    fv.shrink_to_fit();
+    CPPUNIT_ASSERT_EQUAL (fv.capacity(), static_cast<std::size_t>(8));
+    CPPUNIT_ASSERT_EQUAL (fv[2], 2.0f);
+
+    mystl::MyAlignedVector<double,64,mystl::MyChunkGrowth<1> > dv(1);
+    CPPUNIT_ASSERT_EQUAL (dv.capacity(), static_cast<std::size_t>(8));
+    for (int i=0; i<9; ++i) {
+        dv.push_back(i);
+    }
+    CPPUNIT_ASSERT_EQUAL (dv.capacity(), static_cast<std::size_t>(16));
+    CPPUNIT_ASSERT (reinterpret_cast<std::size_t>(dv.data())%64==0);
+
+    //8 elements of 12 bytes fill 3 blocks of 32 bytes
+    struct Triple { float x, y, z; };
+    mystl::MyAlignedVector<Triple,32> tv(1);
+    CPPUNIT_ASSERT_EQUAL (tv.capacity(), static_cast<std::size_t>(8));
+    tv.reserve(9);
+    CPPUNIT_ASSERT_EQUAL (tv.capacity(), static_cast<std::size_t>(16));
+    CPPUNIT_ASSERT (tv.capacity()*sizeof(Triple)%32==0);
+
+    //elements larger than the alignment are not padded
+    mystl::MyAlignedVector<std::string,16> sv(3);
+    CPPUNIT_ASSERT_EQUAL (sv.capacity(), static_cast<std::size_t>(3));
+    sv.push_back("aligned");
+    CPPUNIT_ASSERT (reinterpret_cast<std::size_t>(sv.data())%16==0);
+
+    //the allocator rebinds for the nodes of a list
+    mystl::MyList<int,mystl::MyAlignedAllocator<int,64> > l;
+    l.push_back(1);
+    CPPUNIT_ASSERT_EQUAL (l.front(), 1);
+}
+
+///\brief Testing MyUnrolledList implementation
+CPPUNIT_TEST_SUITE_REGISTRATION (myunrolledlisttest);
+
+///Prepares the test environment
+void myunrolledlisttest :: setUp (void) {
+    const std::string fileName("numeri.txt");
+    std::fstream f(fileName.c_str());
+    if (!f.is_open()) {
+        std::cerr << "Il file " << fileName << " non esiste\n";
+        return;
+    }
+    std::string word;
+    while (f >> word) {
+        l.push_back(word);
+    }
+}
+
+///Cleanes the test environment
+void myunrolledlisttest :: tearDown (void) {
+    // no need to delete anything
+}
+
+///Tests the copy constructor and the operator =
+void myunrolledlisttest :: constructorTest (void) {
+    mystl::MyUnrolledList<std::string,4> copyl(l);
+    CPPUNIT_ASSERT_EQUAL (copyl.size(), 11);
+    CPPUNIT_ASSERT (myequal(l.begin(), l.end(), copyl.begin()));
+
+    copyl.push_back("element to be erased");
+    copyl=emptyl;
+    CPPUNIT_ASSERT (copyl.empty());
+    copyl=l;
+    CPPUNIT_ASSERT_EQUAL (join(copyl.begin(),copyl.end()), join(l.begin(),l.end()));
+}
+
+///Tests push_front() pop_front() and front() methods
+void myunrolledlisttest :: ppfTest (void) {
+    for (int i=0; i<10; ++i) {
+        l.push_front("menouno");
+    }
+    CPPUNIT_ASSERT_EQUAL (l.front(), std::string("menouno"));
+    CPPUNIT_ASSERT_EQUAL (l.size(), 21);
+    for (int i=0; i<10; ++i) {
+        l.pop_front();
+    }
+    CPPUNIT_ASSERT_EQUAL (l.front(), std::string("zero"));
+    while (!l.empty()) {
+        l.pop_front();
+    }
+    CPPUNIT_ASSERT (l.begin()==l.end());
+    l.emplace_front(3,'x');
+    CPPUNIT_ASSERT_EQUAL (l.back(), std::string("xxx"));
+}
+
+///Tests push_back() pop_back() and back() methods
+void myunrolledlisttest :: ppbTest (void) {
+    l.push_back("undici");
+    CPPUNIT_ASSERT_EQUAL (l.back(), std::string("undici"));
+    l.pop_back();
+    CPPUNIT_ASSERT_EQUAL (l.back(), std::string("dieci"));
+    while (!l.empty()) {
+        l.pop_back();
+    }
+    CPPUNIT_ASSERT (l.rbegin()==l.rend());
+    l.emplace_back(3,'x');
+    CPPUNIT_ASSERT_EQUAL (l.front(), std::string("xxx"));
+}
+
+///Tests iterator and reverse_iterator classes
+void myunrolledlisttest :: iteratorTest (void) {
+    CPPUNIT_ASSERT_EQUAL (join(l.begin(),l.end()), std::string("zero uno due tre quattro cinque sei sette otto nove dieci "));
+    CPPUNIT_ASSERT_EQUAL (join(l.rbegin(),l.rend()), std::string("dieci nove otto sette sei cinque quattro tre due uno zero "));
+    CPPUNIT_ASSERT_EQUAL (mylength(l.begin(),l.end()), 11);
+    CPPUNIT_ASSERT_EQUAL (*myfind(l.begin(),l.end(),std::string("sei")), std::string("sei"));
+    CPPUNIT_ASSERT (myfind(l.begin(),l.end(),std::string("undici"))==l.end());
+
+    MyUnrolledList<std::string,4>::iterator it=l.end();
+    --it;
+    CPPUNIT_ASSERT_EQUAL (*it, std::string("dieci"));
+    for (int i=0; i<6; ++i) {
+        it--;
+    }
+    CPPUNIT_ASSERT_EQUAL (*it, std::string("quattro"));
+    it++;
+    CPPUNIT_ASSERT_EQUAL (*it, std::string("cinque"));
+    CPPUNIT_ASSERT_EQUAL (it->size(), static_cast<std::size_t>(6));
+
+    //the standard algorithms and the range members of other containers accept its iterators
+    CPPUNIT_ASSERT_EQUAL (std::distance(l.begin(),l.end()), static_cast<std::ptrdiff_t>(11));
+    CPPUNIT_ASSERT_EQUAL (std::distance(l.rbegin(),l.rend()), static_cast<std::ptrdiff_t>(11));
+    mystl::MyVector<std::string> v(l.begin(),l.end());
+    CPPUNIT_ASSERT_EQUAL (v[10], std::string("dieci"));
+    v.assign(l.rbegin(),l.rend());
+    CPPUNIT_ASSERT_EQUAL (v[0], std::string("dieci"));
+    v.insert(v.begin(),l.begin(),l.end());
+    CPPUNIT_ASSERT_EQUAL (v.size(), static_cast<std::size_t>(22));
+    CPPUNIT_ASSERT (std::equal(l.begin(),l.end(),v.begin()));
+}
+
+///Tests insert() against a std::list
+void myunrolledlisttest :: insertTest (void) {
+    mystl::MyUnrolledList<int,4> ul;
+    std::list<int> sl;
+    for (int i=0; i<500; ++i) {
+        const int pos=(i*37)%(static_cast<int>(sl.size())+1);
+        MyUnrolledList<int,4>::iterator uit=ul.begin();
+        std::list<int>::iterator sit=sl.begin();
+        for (int k=0; k<pos; ++k) {
+            ++uit;
+            ++sit;
+        }
+        uit=ul.insert(uit,i);
+        sl.insert(sit,i);
+        CPPUNIT_ASSERT_EQUAL (*uit, i);
+    }
+    CPPUNIT_ASSERT_EQUAL (ul.size(), 500);
+    CPPUNIT_ASSERT (myequal(sl.begin(),sl.end(),ul.begin()));
+    CPPUNIT_ASSERT (myequal(sl.rbegin(),sl.rend(),ul.rbegin()));
+
+    //inserting an element of the list itself
+    l.insert(l.begin(),*myfind(l.begin(),l.end(),std::string("tre")));
+    CPPUNIT_ASSERT_EQUAL (l.front(), std::string("tre"));
+}
+
+///Tests erase() against a std::list
+void myunrolledlisttest :: eraseTest (void) {
+    mystl::MyUnrolledList<int,4> ul;
+    std::list<int> sl;
+    for (int i=0; i<500; ++i) {
+        ul.push_back(i);
+        sl.push_back(i);
+    }
+    for (int i=0; i<450; ++i) {
+        const int pos=(i*53)%static_cast<int>(sl.size());
+        MyUnrolledList<int,4>::iterator uit=ul.begin();
+        std::list<int>::iterator sit=sl.begin();
+        for (int k=0; k<pos; ++k) {
+            ++uit;
+            ++sit;
+        }
+        uit=ul.erase(uit);
+        sit=sl.erase(sit);
+        CPPUNIT_ASSERT (sit==sl.end() ? uit==ul.end() : *uit==*sit);
+    }
+    CPPUNIT_ASSERT_EQUAL (ul.size(), 50);
+    CPPUNIT_ASSERT (myequal(sl.begin(),sl.end(),ul.begin()));
+    CPPUNIT_ASSERT (myequal(sl.rbegin(),sl.rend(),ul.rbegin()));
+    while (!ul.empty()) {
+        ul.erase(ul.begin());
+    }
+    CPPUNIT_ASSERT (ul.begin()==ul.end());
+}
+
+///Test exceptional behaviour
+void myunrolledlisttest :: exceptionTest (void) {
+    CPPUNIT_ASSERT_THROW (emptyl.front(), std::out_of_range);
+    CPPUNIT_ASSERT_THROW (emptyl.back(), std::out_of_range);
+    CPPUNIT_ASSERT_THROW (emptyl.pop_front(), std::out_of_range);
+    CPPUNIT_ASSERT_THROW (emptyl.pop_back(), std::out_of_range);
+}
+
+///\brief Testing MyIntrusiveList implementation
+CPPUNIT_TEST_SUITE_REGISTRATION (myintrusivelisttest);
+
+///Prepares the test environment
+void myintrusivelisttest :: setUp (void) {
+    for (int i=0; i<5; ++i) {
+        tasks[i].id=i;
+        runq.push_back(tasks[i]);
+        lru.push_front(tasks[i]);
+    }
+}
+
+///Cleanes the test environment
+void myintrusivelisttest :: tearDown (void) {
+    // no need to delete anything
+}
+
+///\brief Joins the ids of a sequence of tasks
+template<class In>
+std::string join_ids(In first, In last) {
+    std::ostringstream str;
+    while (first!=last) {
+        str << (*first).id << " ";
+        ++first;
+    }
+    return(str.str());
+}
+
+///Tests push_front() push_back() pop_front() pop_back() front() and back() methods
+void myintrusivelisttest :: ppTest (void) {
+    CPPUNIT_ASSERT_EQUAL (runq.size(), 5);
+    CPPUNIT_ASSERT (&runq.front()==&tasks[0]);
+    CPPUNIT_ASSERT (&lru.front()==&tasks[4]);
+    runq.pop_front();
+    runq.pop_back();
+    CPPUNIT_ASSERT_EQUAL (runq.front().id, 1);
+    CPPUNIT_ASSERT_EQUAL (runq.back().id, 3);
+    CPPUNIT_ASSERT (!tasks[0].run.is_linked());
+    CPPUNIT_ASSERT (tasks[0].lru.is_linked());
+    runq.push_front(tasks[4]);
+    CPPUNIT_ASSERT_EQUAL (runq.front().id, 4);
+    runq.clear();
+    CPPUNIT_ASSERT (runq.empty());
+    CPPUNIT_ASSERT (!tasks[2].run.is_linked());
+    CPPUNIT_ASSERT_EQUAL (lru.size(), 5);
+}
+
+///Tests iterator and reverse_iterator classes
+void myintrusivelisttest :: iteratorTest (void) {
+    CPPUNIT_ASSERT_EQUAL (join_ids(runq.begin(),runq.end()), std::string("0 1 2 3 4 "));
+    CPPUNIT_ASSERT_EQUAL (join_ids(runq.rbegin(),runq.rend()), std::string("4 3 2 1 0 "));
+    CPPUNIT_ASSERT_EQUAL (join_ids(lru.begin(),lru.end()), std::string("4 3 2 1 0 "));
+    CPPUNIT_ASSERT_EQUAL (mylength(runq.begin(),runq.end()), 5);
+    MyIntrusiveList<Task,&Task::run>::iterator it=runq.end();
+    --it;
+    CPPUNIT_ASSERT (&*it==&tasks[4]);
+    CPPUNIT_ASSERT (runq.iterator_to(tasks[2])==++(++runq.begin()));
+}
+
+///Tests insert() and erase() and the membership in two lists
+void myintrusivelisttest :: eraseTest (void) {
+    //move to the front of the LRU queue, knowing only the object
+    lru.erase(tasks[1]);
+    lru.push_front(tasks[1]);
+    CPPUNIT_ASSERT_EQUAL (join_ids(lru.begin(),lru.end()), std::string("1 4 3 2 0 "));
+    //the other list is not affected
+    CPPUNIT_ASSERT_EQUAL (join_ids(runq.begin(),runq.end()), std::string("0 1 2 3 4 "));
+
+    MyIntrusiveList<Task,&Task::run>::iterator it=runq.erase(runq.iterator_to(tasks[2]));
+    CPPUNIT_ASSERT (&*it==&tasks[3]);
+    runq.insert(runq.begin(),tasks[2]);
+    CPPUNIT_ASSERT_EQUAL (join_ids(runq.begin(),runq.end()), std::string("2 0 1 3 4 "));
+    CPPUNIT_ASSERT_EQUAL (runq.size(), 5);
+
+    Task extra(9);
+    runq.insert(runq.end(),extra);
+    CPPUNIT_ASSERT (&runq.back()==&extra);
+    runq.erase(extra);
+    CPPUNIT_ASSERT (!extra.run.is_linked());
+}
+
+///Test exceptional behaviour
+void myintrusivelisttest :: exceptionTest (void) {
+    runq.clear();
+    CPPUNIT_ASSERT_THROW (runq.front(), std::out_of_range);
+    CPPUNIT_ASSERT_THROW (runq.back(), std::out_of_range);
+    CPPUNIT_ASSERT_THROW (runq.pop_front(), std::out_of_range);
+    CPPUNIT_ASSERT_THROW (runq.pop_back(), std::out_of_range);
+    CPPUNIT_ASSERT_THROW (lru.push_back(tasks[0]), std::invalid_argument);
+    CPPUNIT_ASSERT_THROW (runq.erase(tasks[0]), std::invalid_argument);
+    CPPUNIT_ASSERT_EQUAL (runq.size(), 0);
+}
+
+///\brief Testing MySmallVector implementation
+CPPUNIT_TEST_SUITE_REGISTRATION (mysmallvectortest);
+
+///Prepares the test environment
+void mysmallvectortest :: setUp (void) {
+    sv.push_back("zero");
+    sv.push_back("uno");
+    sv.push_back("due");
+}
+
+///Cleanes the test environment
+void mysmallvectortest :: tearDown (void) {
+    // no need to delete anything
+}
+
+///Tests the switch from the inline buffer to the heap
+void mysmallvectortest :: inlineTest (void) {
+    CPPUNIT_ASSERT (sv.is_inline());
+    CPPUNIT_ASSERT_EQUAL (sv.capacity(), static_cast<std::size_t>(4));
+    sv.push_back("tre");
+    CPPUNIT_ASSERT (sv.is_inline());
+    sv.push_back("quattro");
+    CPPUNIT_ASSERT (!sv.is_inline());
+    CPPUNIT_ASSERT (sv.capacity()>=5);
+
+    std::string str;
+    for (MyVector<std::string>::iterator it = sv.begin(); it != sv.end(); ++it) {
+        str.append(*it);
+        str.append(" ");
+    }
+    CPPUNIT_ASSERT_EQUAL (str, std::string("zero uno due tre quattro "));
+}
+
+///Tests the copy constructors and the operator =
+void mysmallvectortest :: constructorTest (void) {
+    mystl::MySmallVector<std::string,4> copysv(sv);
+    CPPUNIT_ASSERT (copysv.is_inline());
+    CPPUNIT_ASSERT_EQUAL (copysv.size(), static_cast<std::size_t>(3));
+    CPPUNIT_ASSERT_EQUAL (copysv[2], std::string("due"));
+
+    mystl::MyVector<std::string> v(100);
+    v.push_back("cento");
+    mystl::MySmallVector<std::string,4> fromv(v);
+    //only the size of the source matters, not its capacity
+    CPPUNIT_ASSERT (fromv.is_inline());
+    CPPUNIT_ASSERT_EQUAL (fromv.front(), std::string("cento"));
+
+    fromv=sv;
+    CPPUNIT_ASSERT_EQUAL (fromv.size(), static_cast<std::size_t>(3));
+    CPPUNIT_ASSERT_EQUAL (fromv.back(), std::string("due"));
+}
+
+///Tests move constructor and move assignment in both storage modes
+void mysmallvectortest :: moveTest (void) {
+    mystl::MySmallVector<std::string,4> movedsv(std::move(sv));
+    CPPUNIT_ASSERT (movedsv.is_inline());
+    CPPUNIT_ASSERT (sv.empty());
+    CPPUNIT_ASSERT_EQUAL (movedsv[1], std::string("uno"));
+
+    movedsv.push_back("tre");
+    movedsv.push_back("quattro");
+    sv=std::move(movedsv);
+    //a heap buffer is stolen and the source goes back to its inline buffer
+    CPPUNIT_ASSERT (!sv.is_inline());
+    CPPUNIT_ASSERT (movedsv.is_inline());
+    CPPUNIT_ASSERT (movedsv.empty());
+    CPPUNIT_ASSERT_EQUAL (sv.size(), static_cast<std::size_t>(5));
+    CPPUNIT_ASSERT_EQUAL (sv.back(), std::string("quattro"));
+
+    //a plain vector moved from an inline one gets its own heap buffer
+    mystl::MySmallVector<std::string,4> small;
+    small.push_back("zero");
+    mystl::MyVector<std::string> v(std::move(small));
+    CPPUNIT_ASSERT_EQUAL (v.front(), std::string("zero"));
+    CPPUNIT_ASSERT (small.empty());
+
+    //moving a plain vector only steals its buffer, moving inline elements may throw
+    CPPUNIT_ASSERT (std::is_nothrow_move_constructible<mystl::MyVector<std::string> >::value);
+    CPPUNIT_ASSERT ((std::is_nothrow_move_constructible<mystl::MySmallVector<std::string,4> >::value));
+    CPPUNIT_ASSERT (!noexcept(mystl::MyVector<std::string>(std::move(small))));
+}
+
+///\brief Testing MyMappedVector implementation
+CPPUNIT_TEST_SUITE_REGISTRATION (mymappedvectortest);
+
+///Prepares the test environment
+void mymappedvectortest :: setUp (void) {
+    fileName="mymappedvector_test.bin";
+}
+
+///Cleanes the test environment
+void mymappedvectortest :: tearDown (void) {
+    std::remove(fileName.c_str());
+}
+
+///Tests a file of fixed-size elements
+void mymappedvectortest :: recordTest (void) {
+    mystl::MyVector<int> v;
+    for (int i=0; i<1000; ++i) {
+        v.push_back(i*i);
+    }
+    mystl::MyMappedVector<int>::write(fileName, v);
+    {
+        mystl::MyMappedVector<int> mv(fileName);
+        CPPUNIT_ASSERT_EQUAL (mv.size(), static_cast<std::size_t>(1000));
+        CPPUNIT_ASSERT (myequal(mv.begin(), mv.end(), v.begin()));
+        CPPUNIT_ASSERT_EQUAL (mv.back(), 999*999);
+        CPPUNIT_ASSERT_EQUAL (*mv.rbegin(), 999*999);
+        //the iterators are the ones of MyVector
+        mystl::MyVector<int>::const_iterator it = mv.begin()+10;
+        CPPUNIT_ASSERT_EQUAL (*it, 100);
+    }
+
+    std::list<double> l;
+    l.push_back(0.5);
+    l.push_back(1.5);
+    mystl::MyMappedVector<double>::write(fileName, l.begin(), l.end());
+    mystl::MyMappedVector<double> mv(fileName);
+    CPPUNIT_ASSERT_EQUAL (mv.size(), static_cast<std::size_t>(2));
+    CPPUNIT_ASSERT_EQUAL (mv[1], 1.5);
+
+    std::vector<int> none;
+    mystl::MyMappedVector<int>::write(fileName, none.begin(), none.end());
+    mystl::MyMappedVector<int> emptymv(fileName);
+    CPPUNIT_ASSERT (emptymv.empty());
+    CPPUNIT_ASSERT (emptymv.begin()==emptymv.end());
+    CPPUNIT_ASSERT_THROW (emptymv.front(), std::out_of_range);
+}
+
+///Tests a file of strings
+void mymappedvectortest :: stringTest (void) {
+    mystl::MyVector<std::string> v;
+    std::fstream f("numeri.txt");
+    std::string word;
+    while (f >> word) {
+        v.push_back(word);
+    }
+    v.push_back("");
+    mystl::MyMappedVector<std::string>::write(fileName, v.begin(), v.end());
+
+    mystl::MyMappedVector<std::string> mv(fileName);
+    CPPUNIT_ASSERT_EQUAL (mv.size(), static_cast<std::size_t>(12));
+    CPPUNIT_ASSERT (mv[0]==std::string("zero"));
+    CPPUNIT_ASSERT (mv[11].empty());
+    CPPUNIT_ASSERT_EQUAL (mv[10].str(), std::string("dieci"));
+    CPPUNIT_ASSERT (myequal(mv.begin(), mv.end(), v.begin()));
+    CPPUNIT_ASSERT_EQUAL (join(mv.begin(), mv.begin()+3), std::string("zero uno due "));
+    CPPUNIT_ASSERT (myfind(mv.begin(), mv.end(), std::string("sette"))-mv.begin()==7);
+    CPPUNIT_ASSERT_EQUAL (mv.end()-mv.begin(), static_cast<std::ptrdiff_t>(12));
+
+    //the full set of random access operators
+    mystl::MyMappedVector<std::string>::const_iterator it = 3+mv.begin();
+    CPPUNIT_ASSERT (it==mv.begin()+3);
+    CPPUNIT_ASSERT (it>mv.begin() && it>=mv.begin()+3 && it<=mv.begin()+3 && !(it>mv.end()));
+    CPPUNIT_ASSERT (mv.end()>=it && !(mv.end()<=it));
+    CPPUNIT_ASSERT_EQUAL ((*it).str(), std::string("tre"));
+    CPPUNIT_ASSERT_EQUAL (std::distance(it, mv.end()), static_cast<std::ptrdiff_t>(9));
+}
+
+///Tests the rejection of invalid files
+void mymappedvectortest :: formatTest (void) {
+    CPPUNIT_ASSERT_THROW (mystl::MyMappedVector<int>("no_such_file.bin").size(), std::runtime_error);
+
+    const int a[] = {1, 2, 3};
+    mystl::MyMappedVector<int>::write(fileName, a, a+3);
+    //a different element type or kind
+    CPPUNIT_ASSERT_THROW (mystl::MyMappedVector<double>(fileName).size(), std::runtime_error);
+    CPPUNIT_ASSERT_THROW (mystl::MyMappedVector<std::string>(fileName).size(), std::runtime_error);
+
+    //a truncated file
+    {
+        std::ofstream out(fileName.c_str(), std::ios::binary|std::ios::in|std::ios::out);
+        out.seekp(0);
+        mystl::MyMappedHeader(0, sizeof(int), 100).write(out);
+    }
+    CPPUNIT_ASSERT_THROW (mystl::MyMappedVector<int>(fileName).size(), std::runtime_error);
+
+    //elements overlapping the header or not aligned
+    mystl::MyMappedVector<int>::write(fileName, a, a+3);
+    const uint64_t offsets[] = {8, 66};
+    for (int i=0; i<2; ++i) {
+        std::ofstream out(fileName.c_str(), std::ios::binary|std::ios::in|std::ios::out);
+        mystl::MyMappedHeader h(0, sizeof(int), 1);
+        h.data_offset=offsets[i];
+        h.write(out);
+        out.close();
+        CPPUNIT_ASSERT_THROW (mystl::MyMappedVector<int>(fileName).size(), std::runtime_error);
+    }
+
+    //a string offset pointing outside the blob, while the last one is correct
+    const std::string words[] = {"zero", "uno", "due"};
+    mystl::MyMappedVector<std::string>::write(fileName, words, words+3);
+    {
+        std::ofstream out(fileName.c_str(), std::ios::binary|std::ios::in|std::ios::out);
+        const uint64_t offset=1000000;
+        out.seekp(mystl::MyMappedHeader::header_size+sizeof(uint64_t));
+        out.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+    }
+    CPPUNIT_ASSERT_THROW (mystl::MyMappedVector<std::string>(fileName).size(), std::runtime_error);
+
+    //a text file
+    {
+        std::ofstream out(fileName.c_str());
+        out << "zero uno due tre quattro cinque sei sette otto nove dieci\n";
+    }
+    CPPUNIT_ASSERT_THROW (mystl::MyMappedVector<int>(fileName).size(), std::runtime_error);
+}
+
+///\brief Testing MyConcurrentVector implementation
+CPPUNIT_TEST_SUITE_REGISTRATION (myconcurrentvectortest);
+
+///Prepares the test environment
+void myconcurrentvectortest :: setUp (void) {
+    const std::string fileName("numeri.txt");
+    std::fstream f(fileName.c_str());
+    if (!f.is_open()) {
+        std::cerr << "Il file " << fileName << " non esiste\n";
+        return;
+    }
+    std::string word;
+    while (f >> word) {
+        v.push_back(word);
+    }
+}
+
+///Cleanes the test environment
+void myconcurrentvectortest :: tearDown (void) {
+    // no need to delete anything
+}
+
+///Tests push_back() and the stability of the addresses
+void myconcurrentvectortest :: ppbTest (void) {
+    CPPUNIT_ASSERT_EQUAL (v.size(), static_cast<std::size_t>(11));
+    CPPUNIT_ASSERT_EQUAL (v[10], std::string("dieci"));
+    const std::string* first = &v[0];
+    mystl::MyConcurrentVector<std::string>::iterator it = v.push_back("undici");
+    CPPUNIT_ASSERT_EQUAL (*it, std::string("undici"));
+    for (int i=0; i<1000; ++i) {
+        v.emplace_back(3,'x');
+    }
+    //growing never moves an element
+    CPPUNIT_ASSERT (&v[0]==first);
+    CPPUNIT_ASSERT_EQUAL (*it, std::string("undici"));
+    CPPUNIT_ASSERT_EQUAL (v.size(), static_cast<std::size_t>(1012));
+    CPPUNIT_ASSERT_EQUAL (v[1011], std::string("xxx"));
+
+    v.clear();
+    CPPUNIT_ASSERT (v.empty());
+    v.push_back("zero");
+    CPPUNIT_ASSERT (&v[0]==first);
+}
+
+///Tests iterator and const_iterator classes
+void myconcurrentvectortest :: iteratorTest (void) {
+    CPPUNIT_ASSERT_EQUAL (join(v.begin(),v.end()), std::string("zero uno due tre quattro cinque sei sette otto nove dieci "));
+    const mystl::MyConcurrentVector<std::string>& cv = v;
+    mystl::MyConcurrentVector<std::string>::const_iterator it = cv.begin()+3;
+    CPPUNIT_ASSERT_EQUAL (*it, std::string("tre"));
+    CPPUNIT_ASSERT_EQUAL (it[2], std::string("cinque"));
+    CPPUNIT_ASSERT_EQUAL (cv.end()-it, static_cast<std::ptrdiff_t>(8));
+    CPPUNIT_ASSERT (myfind(v.begin(), v.end(), std::string("sette"))-v.begin()==7);
+    mystl::MyConcurrentVector<std::string>::const_iterator cit = v.begin();
+    CPPUNIT_ASSERT (cit==cv.cbegin());
+}
+
+///Tests grow_by() methods
+void myconcurrentvectortest :: grow_byTest (void) {
+    mystl::MyConcurrentVector<int> iv;
+    iv.reserve(100);
+    mystl::MyConcurrentVector<int>::iterator it = iv.grow_by(5);
+    CPPUNIT_ASSERT_EQUAL (join(iv.begin(),iv.end()), std::string("0 0 0 0 0 "));
+    //the new elements span several segments
+    it = iv.grow_by(100,7);
+    CPPUNIT_ASSERT_EQUAL (it-iv.begin(), static_cast<std::ptrdiff_t>(5));
+    CPPUNIT_ASSERT_EQUAL (iv.size(), static_cast<std::size_t>(105));
+    CPPUNIT_ASSERT_EQUAL (iv[104], 7);
+}
+
+///Tests the failed appends
+void myconcurrentvectortest :: exceptionTest (void) {
+    //a constructor that may throw runs before the slot is claimed, when the element can be moved in
+    mystl::MyConcurrentVector<std::string> sv;
+    sv.push_back("zero");
+    CPPUNIT_ASSERT_THROW (sv.emplace_back(static_cast<const char*>(0)), std::logic_error);
+    sv.push_back("uno");
+    CPPUNIT_ASSERT_EQUAL (sv.size(), static_cast<std::size_t>(2));
+    CPPUNIT_ASSERT_EQUAL (sv[1], std::string("uno"));
+
+    //otherwise the slot becomes a hole, counted by size() and skipped by the iterators
+    mystl::MyConcurrentVector<Fragile> fv;
+    fv.emplace_back(0);
+    CPPUNIT_ASSERT_THROW (fv.emplace_back(-1), std::invalid_argument);
+    fv.emplace_back(2);
+    CPPUNIT_ASSERT_EQUAL (fv.size(), static_cast<std::size_t>(3));
+    CPPUNIT_ASSERT (fv.is_hole(1));
+    CPPUNIT_ASSERT (!fv.is_hole(2));
+    CPPUNIT_ASSERT_EQUAL (fv[2].val, 2);
+    mystl::MyConcurrentVector<Fragile>::const_iterator it = fv.begin();
+    CPPUNIT_ASSERT_EQUAL ((it++)->val, 0);
+    CPPUNIT_ASSERT_EQUAL (it->val, 2);
+    CPPUNIT_ASSERT (++it==fv.end());
+    CPPUNIT_ASSERT_EQUAL (std::distance(fv.begin(), fv.end()), static_cast<std::ptrdiff_t>(2));
+
+    //an end() taken before a hole appears there still stops the walk
+    mystl::MyConcurrentVector<Fragile>::iterator end = fv.end();
+    Fragile::copies=false;
+    CPPUNIT_ASSERT_THROW (fv.grow_by(2, Fragile(5)), std::runtime_error);
+    Fragile::copies=true;
+    fv.emplace_back(6);
+    CPPUNIT_ASSERT_EQUAL (fv.size(), static_cast<std::size_t>(6));
+    CPPUNIT_ASSERT (++(fv.begin()+2)==end);
+    int sum = 0;
+    for (mystl::MyConcurrentVector<Fragile>::iterator i=fv.begin(); i!=fv.end(); ++i) {
+        sum += i->val;
+    }
+    CPPUNIT_ASSERT_EQUAL (sum, 8);
+    CPPUNIT_ASSERT_EQUAL ((--fv.end())->val, 6);
+    CPPUNIT_ASSERT_EQUAL ((--(--fv.end()))->val, 2);
+}
+
+///Tests threads appending and reading at the same time
+void myconcurrentvectortest :: threadTest (void) {
+    const int threads = 4;
+    const int per_thread = 20000;
+    mystl::MyConcurrentVector<int> iv;
+    std::vector<std::thread> writers;
+    for (int t=0; t<threads; ++t) {
+        writers.push_back(std::thread([&iv, t, per_thread]() {
+            for (int i=0; i<per_thread; ++i) {
+                iv.push_back(t*per_thread+i);
+            }
+        }));
+    }
+    //a reader sees every element below the size it observes
+    bool consistent = true;
+    std::thread reader([&iv, &consistent, threads, per_thread]() {
+        for (int round=0; round<100; ++round) {
+            const std::size_t n = iv.size();
+            for (std::size_t i=0; i<n; ++i) {
+                if (iv[i]<0 || iv[i]>=threads*per_thread) {
+                    consistent=false;
+                }
+            }
+        }
+    });
+    for (int t=0; t<threads; ++t) {
+        writers[t].join();
+    }
+    reader.join();
+    CPPUNIT_ASSERT (consistent);
+    CPPUNIT_ASSERT_EQUAL (iv.size(), static_cast<std::size_t>(threads*per_thread));
+
+    //every value was appended once, and the values of a thread keep their order
+    std::vector<int> seen(iv.begin(), iv.end());
+    std::vector<int> last(threads, -1);
+    for (std::size_t i=0; i<seen.size(); ++i) {
+        const int t = seen[i]/per_thread;
+        CPPUNIT_ASSERT (seen[i]>last[t]);
+        last[t] = seen[i];
+    }
+    std::sort(seen.begin(), seen.end());
+    for (int i=0; i<threads*per_thread; ++i) {
+        CPPUNIT_ASSERT_EQUAL (seen[i], i);
+    }
+}
+
+///\brief Testing MySoAVector implementation
+CPPUNIT_TEST_SUITE_REGISTRATION (mysoavectortest);
+
+///Prepares the test environment
+void mysoavectortest :: setUp (void) {
+    records.push_back(std::make_tuple(1, 0.5, std::string("zero")));
+    records.push_back(std::make_tuple(2, 1.5, std::string("uno")));
+    records.emplace_back(3, 2.5, "due");
+}
+
+///Cleanes the test environment
+void mysoavectortest :: tearDown (void) {
+    // no need to delete anything
+}
+
+///Tests push_back() emplace_back() pop_back() and the access to the records
+void mysoavectortest :: ppbTest (void) {
+    CPPUNIT_ASSERT_EQUAL (records.size(), static_cast<std::size_t>(3));
+    CPPUNIT_ASSERT (records[1]==std::make_tuple(2, 1.5, std::string("uno")));
+    CPPUNIT_ASSERT_EQUAL (records.get<2>(2), std::string("due"));
+
+    //the proxy writes through to the columns
+    records[0] = std::make_tuple(10, 9.5, std::string("dieci"));
+    std::get<1>(records[1]) = 4.5;
+    CPPUNIT_ASSERT_EQUAL (records.get<0>(0), 10);
+    CPPUNIT_ASSERT_EQUAL (records.get<1>(1), 4.5);
+
+    records.pop_back();
+    CPPUNIT_ASSERT_EQUAL (records.size(), static_cast<std::size_t>(2));
+    records.clear();
+    CPPUNIT_ASSERT (records.empty());
+    CPPUNIT_ASSERT_THROW (records.pop_back(), std::out_of_range);
+}
+
+///Tests column() and the algorithms on a single column
+void mysoavectortest :: columnTest (void) {
+    records.reserve(100);
+    for (int i=4; i<100; ++i) {
+        records.emplace_back(i, i*0.5, "altro");
+    }
+    mystl::MySpan<double> scores = records.column<1>();
+    CPPUNIT_ASSERT_EQUAL (scores.size(), static_cast<std::size_t>(99));
+    //every column is contiguous
+    CPPUNIT_ASSERT (&scores[98]==scores.data()+98);
+    CPPUNIT_ASSERT (myfind(scores.begin(), scores.end(), 2.5)-scores.begin()==2);
+    scores[0]=-1;
+    CPPUNIT_ASSERT_EQUAL (records.get<1>(0), -1.0);
+
+    const Records& crecords = records;
+    mystl::MySpan<const int> ids = crecords.column<0>();
+    mystl::MyVector<int> expected;
+    for (int i=1; i<100; ++i) {
+        expected.push_back(i);
+    }
+    CPPUNIT_ASSERT (myequal(ids.begin(), ids.end(), expected.begin()));
+    mystl::MySpan<const std::string> names = crecords.column<2>();
+    CPPUNIT_ASSERT (myfind(names.begin(), names.end(), std::string("uno"))==names.begin()+1);
+}
+
+///Tests iterator and const_iterator classes
+void mysoavectortest :: iteratorTest (void) {
+    std::string str;
+    for (Records::iterator it = records.begin(); it != records.end(); ++it) {
+        str.append(std::get<2>(*it));
+        str.append(" ");
+    }
+    CPPUNIT_ASSERT_EQUAL (str, std::string("zero uno due "));
+
+    Records::iterator it = records.begin()+2;
+    CPPUNIT_ASSERT_EQUAL (std::get<0>(*it), 3);
+    CPPUNIT_ASSERT_EQUAL (std::get<0>(it[-1]), 2);
+    CPPUNIT_ASSERT_EQUAL (records.end()-records.begin(), static_cast<std::ptrdiff_t>(3));
+    Records::const_iterator cit = it;
+    CPPUNIT_ASSERT (cit==records.cbegin()+2);
+    //rows compare as tuples
+    CPPUNIT_ASSERT (myfind(records.cbegin(), records.cend(), std::make_tuple(2, 1.5, std::string("uno")))==records.cbegin()+1);
+}
+
+///\brief Testing MyDeque implementation
+CPPUNIT_TEST_SUITE_REGISTRATION (mydequetest);
+
+///Prepares the test environment
+void mydequetest :: setUp (void) {
+    //-9 ... -1 0 ... 9
+    for (int i=0; i<10; ++i) {
+        deque.push_back(i);
+    }
+    for (int i=1; i<10; ++i) {
+        deque.push_front(-i);
+    }
+    sdeque.push_back("uno");
+    sdeque.push_front("zero");
+    sdeque.emplace_back(3, 'x');
+}
+
+///Cleanes the test environment
+void mydequetest :: tearDown (void) {
+    // no need to delete anything
+}
+
+///Tests push_front() push_back() pop_front() pop_back()
+void mydequetest :: ppbTest (void) {
+    CPPUNIT_ASSERT_EQUAL (deque.size(), static_cast<std::size_t>(19));
+    CPPUNIT_ASSERT_EQUAL (deque.front(), -9);
+    CPPUNIT_ASSERT_EQUAL (deque.back(), 9);
+    for (std::size_t i=0; i<deque.size(); ++i) {
+        CPPUNIT_ASSERT_EQUAL (deque[i], static_cast<int>(i)-9);
+    }
+    deque.pop_front();
+    deque.pop_back();
+    CPPUNIT_ASSERT_EQUAL (deque.front(), -8);
+    CPPUNIT_ASSERT_EQUAL (deque.back(), 8);
+    while (!deque.empty()) {
+        deque.pop_back();
+    }
+    CPPUNIT_ASSERT_THROW (deque.pop_back(), std::out_of_range);
+    CPPUNIT_ASSERT_THROW (deque.pop_front(), std::out_of_range);
+    CPPUNIT_ASSERT_THROW (deque.front(), std::out_of_range);
+    deque.push_front(7);
+    CPPUNIT_ASSERT_EQUAL (deque.back(), 7);
+
+    CPPUNIT_ASSERT_EQUAL (sdeque.size(), static_cast<std::size_t>(3));
+    CPPUNIT_ASSERT_EQUAL (sdeque[0], std::string("zero"));
+    CPPUNIT_ASSERT_EQUAL (sdeque[2], std::string("xxx"));
+    sdeque.pop_front();
+    CPPUNIT_ASSERT_EQUAL (sdeque.front(), std::string("uno"));
+    sdeque.clear();
+    CPPUNIT_ASSERT (sdeque.empty());
+}
+
+///Tests that the elements are never moved while the deque grows
+void mydequetest :: stableTest (void) {
+    int* first = &deque[0];
+    int* last = &deque[deque.size()-1];
+    for (int i=10; i<1000; ++i) {
+        deque.push_back(i);
+        deque.push_front(-i);
+    }
+    CPPUNIT_ASSERT (first==&deque[990]);
+    CPPUNIT_ASSERT (last==&deque[1008]);
+    CPPUNIT_ASSERT_EQUAL (*first, -9);
+    CPPUNIT_ASSERT_EQUAL (deque.front(), -999);
+    CPPUNIT_ASSERT_EQUAL (deque.back(), 999);
+}
+
+///Tests a deque used as a queue, moving through many blocks
+void mydequetest :: queueTest (void) {
+    deque.clear();
+    int next=0;
+    for (int round=0; round<1000; ++round) {
+        for (int k=0; k<3; ++k) {
+            deque.push_back(round*3+k);
+        }
+        for (int k=0; k<2; ++k) {
+            CPPUNIT_ASSERT_EQUAL (deque.front(), next++);
+            deque.pop_front();
+        }
+    }
+    CPPUNIT_ASSERT_EQUAL (deque.size(), static_cast<std::size_t>(1000));
+    for (std::size_t i=0; i<deque.size(); ++i) {
+        CPPUNIT_ASSERT_EQUAL (deque[i], next+static_cast<int>(i));
+    }
+}
+
+///Tests iterator and const_iterator classes
+void mydequetest :: iteratorTest (void) {
+    int sum=0;
+    for (MyDeque<int,4>::iterator it = deque.begin(); it != deque.end(); ++it) {
+        sum+=*it;
+    }
+    CPPUNIT_ASSERT_EQUAL (sum, 0);
+    CPPUNIT_ASSERT_EQUAL (deque.end()-deque.begin(), static_cast<std::ptrdiff_t>(19));
+
+    MyDeque<int,4>::iterator it = deque.begin()+13;
+    CPPUNIT_ASSERT_EQUAL (*it, 4);
+    CPPUNIT_ASSERT_EQUAL (it[-13], -9);
+    CPPUNIT_ASSERT_EQUAL (*(it-6), -2);
+    CPPUNIT_ASSERT_EQUAL (*(3+it), 7);
+    CPPUNIT_ASSERT (it-deque.begin()==13);
+    --it;
+    CPPUNIT_ASSERT_EQUAL (*it--, 3);
+    CPPUNIT_ASSERT_EQUAL (*it, 2);
+    CPPUNIT_ASSERT (deque.begin()<it && it<deque.end());
+    *it=100;
+    CPPUNIT_ASSERT_EQUAL (deque[11], 100);
+
+    const MyDeque<int,4>& cdeque = deque;
+    MyDeque<int,4>::const_iterator cit = it;
+    CPPUNIT_ASSERT (cit==cdeque.begin()+11);
+    CPPUNIT_ASSERT (myfind(cdeque.begin(), cdeque.end(), 5)==cdeque.begin()+14);
+    CPPUNIT_ASSERT (myfind(cdeque.begin(), cdeque.end(), 50)==cdeque.end());
+
+    MyVector<int> v(deque.begin(), deque.end());
+    CPPUNIT_ASSERT (myequal(v.begin(), v.end(), deque.cbegin()));
+    CPPUNIT_ASSERT_EQUAL (sdeque.begin()->size(), static_cast<std::size_t>(4));
+}
+
+///Tests the copy and the move of a deque
+void mydequetest :: copyTest (void) {
+    MyDeque<int,4> copy(deque);
+    deque[0]=42;
+    CPPUNIT_ASSERT_EQUAL (copy.size(), static_cast<std::size_t>(19));
+    CPPUNIT_ASSERT_EQUAL (copy.front(), -9);
+
+    MyDeque<int,4> moved(std::move(copy));
+    CPPUNIT_ASSERT (copy.empty());
+    CPPUNIT_ASSERT_EQUAL (moved.back(), 9);
+    copy.push_back(1);
+    CPPUNIT_ASSERT_EQUAL (copy.front(), 1);
+
+    moved=deque;
+    CPPUNIT_ASSERT_EQUAL (moved.front(), 42);
+    copy=std::move(moved);
+    CPPUNIT_ASSERT_EQUAL (copy.size(), static_cast<std::size_t>(19));
+    CPPUNIT_ASSERT (moved.empty());
+
+    MyDeque<std::string,3> scopy;
+    scopy=sdeque;
+    CPPUNIT_ASSERT_EQUAL (scopy[1], std::string("uno"));
+
+    //blocks of another arena are not stolen, the elements move into the arena of the target
+    typedef mystl::MyArenaAllocator<int> Ialloc;
+    mystl::MyArena a1(4096);
+    MyDeque<int,64,Ialloc> d1((Ialloc(a1)));
+    {
+        mystl::MyArena a2(4096);
+        MyDeque<int,64,Ialloc> d2((Ialloc(a2)));
+        for (int i=0; i<100; ++i) {
+            d2.push_back(i);
+        }
+        d1=std::move(d2);
+        CPPUNIT_ASSERT (d2.empty());
+    }
+    CPPUNIT_ASSERT_EQUAL (d1.size(), static_cast<std::size_t>(100));
+    for (int i=0; i<100; ++i) {
+        CPPUNIT_ASSERT_EQUAL (d1[i], i);
+    }
+    CPPUNIT_ASSERT (d1.get_allocator()==Ialloc(a1));
+}
+
+///\brief Testing MySTL allocators
+CPPUNIT_TEST_SUITE_REGISTRATION (myallocatortest);
+
+///Prepares the test environment
+void myallocatortest :: setUp (void) {
+    // nothing to prepare
+}
+
+///Cleanes the test environment
+void myallocatortest :: tearDown (void) {
+    // no need to delete anything
+}
+
+///Tests MyArena and MyArenaAllocator
+void myallocatortest :: arenaTest (void) {
+    mystl::MyArena arena(256);
+    char* c = static_cast<char*>(arena.allocate(1,1));
+    double* d = static_cast<double*>(arena.allocate(sizeof(double),alignof(double)));
+    CPPUNIT_ASSERT (reinterpret_cast<std::size_t>(d)%alignof(double)==0);
+    CPPUNIT_ASSERT (reinterpret_cast<char*>(d)>c);
+    //requests larger than a block get their own block
+    CPPUNIT_ASSERT (arena.allocate(1000,8)!=0);
+
+    typedef mystl::MyArenaAllocator<std::string> Talloc;
+    mystl::MyVector<std::string,Talloc> v(2,Talloc(arena));
+    mystl::MyList<std::string,Talloc> l((Talloc(arena)));
+    for (int i=0; i<100; ++i) {
+        v.push_back("arena");
+        l.push_front("arena");
+    }
+    CPPUNIT_ASSERT_EQUAL (v.size(), static_cast<std::size_t>(100));
+    CPPUNIT_ASSERT_EQUAL (l.size(), 100);
+    CPPUNIT_ASSERT (v.get_allocator()==l.get_allocator());
+}
+
+///Tests MyPool and MyPoolAllocator
+void myallocatortest :: poolTest (void) {
+    mystl::MyPool pool(sizeof(long));
+    void* p1 = pool.allocate();
+    void* p2 = pool.allocate();
+    CPPUNIT_ASSERT (p1!=p2);
+    pool.deallocate(p1);
+    //freed chunks are recycled first
+    CPPUNIT_ASSERT (pool.allocate()==p1);
+
+    mystl::MyPool nodes;
+    typedef mystl::MyPoolAllocator<int> Talloc;
+    mystl::MyPoolAllocator<long> la((Talloc(nodes)));
+    long* l1 = la.allocate(1);
+    //the chunk size is decided by the first allocation
+    CPPUNIT_ASSERT (nodes.chunk_size()>=sizeof(long));
+    la.deallocate(l1,1);
+    CPPUNIT_ASSERT (la.allocate(1)==l1);
+
+    //buffers larger than a chunk come from the heap
+    mystl::MyVector<int,Talloc> v(100,Talloc(nodes));
+    for (int i=0; i<1000; ++i) {
+        v.push_back(i);
+    }
+    CPPUNIT_ASSERT_EQUAL (v[999], 999);
+}
+
+///Tests MyMmapAllocator
+void myallocatortest :: mmapTest (void) {
+    typedef mystl::MyMmapAllocator<int> Talloc;
+    //the buffer starts on the heap and is mapped once it reaches 64KB
+    mystl::MyVector<int,Talloc> v(Talloc(64*1024,true));
+    for (int i=0; i<1000000; ++i) {
+        v.push_back(i);
+    }
+    CPPUNIT_ASSERT_EQUAL (v[0], 0);
+    CPPUNIT_ASSERT_EQUAL (v[999999], 999999);
+    v.shrink_to_fit();
+    CPPUNIT_ASSERT_EQUAL (v[999999], 999999);
+    v.resize(10);
+    v.shrink_to_fit();
+    CPPUNIT_ASSERT_EQUAL (v[9], 9);
+
+    //elements that are not trivially copyable are relocated one by one
+    mystl::MyVector<std::string,mystl::MyMmapAllocator<std::string> > sv(mystl::MyMmapAllocator<std::string>(0));
+    for (int i=0; i<5000; ++i) {
+        sv.push_back("mmap");
+    }
+    CPPUNIT_ASSERT_EQUAL (sv[4999], std::string("mmap"));
+    CPPUNIT_ASSERT (sv.get_allocator()==mystl::MyMmapAllocator<std::string>(0));
+}
+
+///Tests containers sharing or not sharing an allocator
+void myallocatortest :: containerTest (void) {
+    mystl::MyArena a1;
+    mystl::MyArena a2;
+    typedef mystl::MyArenaAllocator<std::string> Talloc;
+    mystl::MyVector<std::string,Talloc> v1(4,Talloc(a1));
+    v1.push_back("zero");
+    v1.push_back("uno");
+
+    //the same arena: the buffer is stolen
+    mystl::MyVector<std::string,Talloc> v2(std::move(v1));
+    CPPUNIT_ASSERT (v1.empty());
+    CPPUNIT_ASSERT_EQUAL (v2.size(), static_cast<std::size_t>(2));
+
+    //different arenas: elements are moved one by one and stay in a2
+    mystl::MyVector<std::string,Talloc> v3(4,Talloc(a2));
+    v3=std::move(v2);
+    CPPUNIT_ASSERT (v3.get_allocator()==Talloc(a2));
+    CPPUNIT_ASSERT_EQUAL (v3[1], std::string("uno"));
+    //so the move can allocate and is not noexcept
+    CPPUNIT_ASSERT ((!std::is_nothrow_move_assignable<mystl::MyVector<std::string,Talloc> >::value));
+    CPPUNIT_ASSERT (std::is_nothrow_move_assignable<mystl::MyVector<std::string> >::value);
+
+    mystl::MyList<std::string,Talloc> l1((Talloc(a1)));
+    l1.push_back("zero");
+    mystl::MyList<std::string,Talloc> l2(l1);
+    CPPUNIT_ASSERT (l2.get_allocator()==Talloc(a1));
+    CPPUNIT_ASSERT_EQUAL (l2.front(), std::string("zero"));
+}
+
 ///\brief Testing MySTL algorithms
 CPPUNIT_TEST_SUITE_REGISTRATION (myalgorithmstest);
 
@@ -368,6 +2161,53 @@ void myalgorithmstest :: mysearchTest (void) {
     ///Negative searches
     CPPUNIT_ASSERT(mysearch(v.begin(), v.end(), l1.begin(), l1.end())==v.end());
     CPPUNIT_ASSERT(mysearch(v.rbegin(), v.rend(), l1.rbegin(), l1.rend())==v.rend());
+
+    ///A match right after a partial one
+    const std::string text("aab");
+    const std::string word("ab");
+    CPPUNIT_ASSERT(mysearch(text.begin(), text.end(), word.begin(), word.end())==text.begin()+1);
+}
+
+///Tests mysearch() with MyKmpSearcher and MyHorspoolSearcher
+///searching the same sequence in different containers
+void myalgorithmstest :: mysearcherTest (void) {
+    mystl::MyList<std::string> l1;
+    l1.push_back(std::string("sei"));
+    l1.push_back(std::string("sette"));
+    l1.push_back(std::string("otto"));
+
+    MyKmpSearcher<std::string> kmp(l1.begin(), l1.end());
+    MyHorspoolSearcher<std::string> horspool(l1.begin(), l1.end());
+    CPPUNIT_ASSERT(mysearch(v.begin(), v.end(), kmp)==&v[6]);
+    CPPUNIT_ASSERT(mysearch(v.begin(), v.end(), horspool)==&v[6]);
+    ///l holds v reversed
+    CPPUNIT_ASSERT(mysearch(l.begin(), l.end(), kmp)==l.end());
+    CPPUNIT_ASSERT(mysearch(v.begin()+7, v.end(), horspool)==v.end());
+
+    const std::string text("abababaabababb, ababababb");
+    const std::string word("abababb");
+    MyKmpSearcher<char> ckmp(word.begin(), word.end());
+    MyHorspoolSearcher<char> chorspool(word.begin(), word.end());
+    CPPUNIT_ASSERT(mysearch(text.begin(), text.end(), ckmp)==text.begin()+7);
+    CPPUNIT_ASSERT(mysearch(text.begin(), text.end(), chorspool)==text.begin()+7);
+    CPPUNIT_ASSERT(mysearch(text.begin()+8, text.end(), chorspool)==text.begin()+18);
+    mystl::MyList<char> chars;
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        chars.push_back(text[i]);
+    }
+    CPPUNIT_ASSERT_EQUAL(mylength(chars.begin(), mysearch(chars.begin(), chars.end(), ckmp)), 7);
+
+    ///A periodic text, where Horspool alone would compare every window
+    std::string periodic(5000, 'a');
+    const std::string needle = "b" + std::string(100, 'a');
+    MyHorspoolSearcher<char> phorspool(needle.begin(), needle.end());
+    CPPUNIT_ASSERT(mysearch(periodic.begin(), periodic.end(), phorspool)==periodic.end());
+    periodic.append(needle);
+    CPPUNIT_ASSERT(mysearch(periodic.begin(), periodic.end(), phorspool)==periodic.begin()+5000);
+
+    ///An empty sequence is found at the beginning
+    MyKmpSearcher<char> empty(word.end(), word.end());
+    CPPUNIT_ASSERT(mysearch(text.begin(), text.end(), empty)==text.begin());
 }
 
 ///Tests myldist() method
@@ -389,3 +2229,220 @@ void myalgorithmstest :: myldistTest (void) {
 
     CPPUNIT_ASSERT_EQUAL(myldist(l.begin(), l.end(), v.begin(), v.end()),2);
 }
+
+///Tests myldist() on sequences longer than a block of Myers' algorithm
+///comparing the bit-parallel results with the ones of the dynamic programming row
+void myalgorithmstest :: myldistLongTest (void) {
+    std::string a("kitten");
+    std::string b("sitting");
+    CPPUNIT_ASSERT_EQUAL(myldist(a.begin(), a.end(), b.begin(), b.end()),3);
+    CPPUNIT_ASSERT_EQUAL(myldist(a.begin(), a.end(), b.end(), b.end()),6);
+
+    unsigned int seed=7;
+    for (int n = 0; n < 300; n += 23) {
+        a.clear();
+        b.clear();
+        for (int i = 0; i < n; ++i) {
+            seed = seed*1103515245+12345;
+            a.push_back(static_cast<char>('a'+(seed>>16)%4));
+            seed = seed*1103515245+12345;
+            b.push_back(static_cast<char>('a'+(seed>>16)%4));
+        }
+        b.append(a, 0, n/2);
+        MyList<char> l2;
+        for (std::size_t i = 0; i < b.size(); ++i) {
+            l2.push_back(b[i]);
+        }
+        const int expected = myldist_rows(a.begin(), a.end(), b.begin(), b.end());
+        CPPUNIT_ASSERT_EQUAL(myldist(a.begin(), a.end(), l2.begin(), l2.end()), expected);
+        CPPUNIT_ASSERT_EQUAL(myldist(l2.begin(), l2.end(), a.begin(), a.end()), expected);
+
+        ///Ordered elements use the bit-parallel algorithm too
+        MyVector<std::string> ta;
+        MyVector<std::string> tb;
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            ta.push_back(std::string(2,a[i]));
+        }
+        for (std::size_t i = 0; i < b.size(); ++i) {
+            tb.push_back(std::string(2,b[i]));
+        }
+        CPPUNIT_ASSERT_EQUAL(myldist(ta.begin(), ta.end(), tb.begin(), tb.end()), expected);
+    }
+
+    CPPUNIT_ASSERT_EQUAL(myldist(v.begin(), v.end(), l.begin(), l.end()), myldist_rows(v.begin(), v.end(), l.begin(), l.end()));
+}
+
+///Tests myldist_bounded() method
+///against myldist() for every threshold around the distance
+void myalgorithmstest :: myldistBoundedTest (void) {
+    mystl::MyList<char> l1;
+    l1.push_back('G');
+    l1.push_back('U');
+    l1.push_back('M');
+    l1.push_back('B');
+    l1.push_back('O');
+    std::string s("GAMBOL");
+
+    CPPUNIT_ASSERT_EQUAL(myldist_bounded(l1.begin(), l1.end(), s.begin(), s.end(), 2),2);
+    CPPUNIT_ASSERT_EQUAL(myldist_bounded(l1.begin(), l1.end(), s.begin(), s.end(), 5),2);
+    CPPUNIT_ASSERT_EQUAL(myldist_bounded(l1.begin(), l1.end(), s.begin(), s.end(), 1),2);
+    CPPUNIT_ASSERT_EQUAL(myldist_bounded(l1.begin(), l1.end(), s.begin(), s.end(), 0),1);
+
+    ///The lengths alone exceed the threshold
+    CPPUNIT_ASSERT_EQUAL(myldist_bounded(s.begin(), s.end(), s.end(), s.end(), 3),4);
+
+    ///A threshold above the lengths gives the distance, without overflowing or allocating a huge band
+    CPPUNIT_ASSERT_EQUAL(myldist_bounded(l1.begin(), l1.end(), s.begin(), s.end(), INT_MAX),2);
+    CPPUNIT_ASSERT_EQUAL(myldist_bounded(s.begin(), s.end(), s.end(), s.end(), INT_MAX-1),6);
+    CPPUNIT_ASSERT_EQUAL(myldist_bounded(s.begin(), s.end(), s.begin(), s.end(), 1000000000),0);
+
+    unsigned int seed=11;
+    for (int n = 1; n < 120; n += 17) {
+        std::string a;
+        for (int i = 0; i < n; ++i) {
+            seed = seed*1103515245+12345;
+            a.push_back(static_cast<char>('a'+(seed>>16)%3));
+        }
+        std::string b(a);
+        for (int e = 0; e < 4; ++e) {
+            seed = seed*1103515245+12345;
+            b[(seed>>16)%b.size()]='z';
+        }
+        b.erase(0,n%3);
+        const int d = myldist(a.begin(), a.end(), b.begin(), b.end());
+        for (int k = 0; k < 10; ++k) {
+            CPPUNIT_ASSERT_EQUAL(myldist_bounded(a.begin(), a.end(), b.begin(), b.end(), k), d<=k ? d : k+1);
+        }
+    }
+}
+
+///Tests myldist_batch() and myldist_nearest() methods
+///against myldist() on one or more threads
+void myalgorithmstest :: myldistBatchTest (void) {
+    const std::string query("settantasette");
+    MyVector<int> expected;
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        expected.push_back(myldist(query.begin(), query.end(), v[i].begin(), v[i].end()));
+    }
+
+    for (unsigned int threads = 1; threads <= 4; threads += 3) {
+        MyVector<int> d = myldist_batch(query.begin(), query.end(), v.begin(), v.end(), threads);
+        CPPUNIT_ASSERT_EQUAL(d.size(), v.size());
+        CPPUNIT_ASSERT(myequal(d.begin(), d.end(), expected.begin()));
+
+        MyVector<std::pair<int,std::size_t> > best = myldist_nearest(query.begin(), query.end(), v.begin(), v.end(), 3, threads);
+        CPPUNIT_ASSERT_EQUAL(best.size(), static_cast<std::size_t>(3));
+        CPPUNIT_ASSERT_EQUAL(v[best[0].second], std::string("sette"));
+        for (std::size_t k = 0; k < best.size(); ++k) {
+            CPPUNIT_ASSERT_EQUAL(best[k].first, expected[best[k].second]);
+            for (std::size_t i = 0; i < v.size(); ++i) {
+                ///nothing left out is nearer
+                CPPUNIT_ASSERT(expected[i] >= best[0].first);
+                if (k == best.size()-1 && expected[i] < best[k].first) {
+                    CPPUNIT_ASSERT(myfind(best.begin(), best.end(), std::make_pair(expected[i], i)) != best.end());
+                }
+            }
+        }
+    }
+
+    ///Sequences compared with operator== only
+    MyVector<MyVector<double> > candidates;
+    for (int i = 0; i < 40; ++i) {
+        candidates.push_back(MyVector<double>());
+        for (int j = 0; j < i%7; ++j) {
+            candidates[i].push_back(j*0.5);
+        }
+    }
+    MyVector<double> q;
+    q.push_back(0.0);
+    q.push_back(1.0);
+    MyVector<int> d = myldist_batch(q.begin(), q.end(), candidates.begin(), candidates.end(), 2);
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+        CPPUNIT_ASSERT_EQUAL(d[i], myldist(q.begin(), q.end(), candidates[i].begin(), candidates[i].end()));
+    }
+    CPPUNIT_ASSERT(myldist_nearest(q.begin(), q.end(), candidates.begin(), candidates.end(), 0).empty());
+
+    ///A pool serves many calls with the same threads
+    MyThreadPool pool(3);
+    CPPUNIT_ASSERT_EQUAL(pool.size(), 3u);
+    for (int round = 0; round < 3; ++round) {
+        d = myldist_batch(q.begin(), q.end(), candidates.begin(), candidates.end(), pool);
+        for (std::size_t i = 0; i < candidates.size(); ++i) {
+            CPPUNIT_ASSERT_EQUAL(d[i], myldist(q.begin(), q.end(), candidates[i].begin(), candidates[i].end()));
+        }
+        MyVector<std::pair<int,std::size_t> > best = myldist_nearest(q.begin(), q.end(), candidates.begin(), candidates.end(), 4, pool);
+        CPPUNIT_ASSERT_EQUAL(best.size(), static_cast<std::size_t>(4));
+        CPPUNIT_ASSERT_EQUAL(best[0].first, *std::min_element(d.begin(), d.end()));
+        CPPUNIT_ASSERT_EQUAL(best[3].first, d[best[3].second]);
+        MyVector<int> words = myldist_batch(query.begin(), query.end(), v.begin(), v.end(), pool);
+        CPPUNIT_ASSERT(myequal(words.begin(), words.end(), expected.begin()));
+    }
+
+    ///An exception thrown by a task reaches the caller, and the pool stays usable
+    MyVector<int> workers;
+    workers.resize(pool.size(), 0);
+    CPPUNIT_ASSERT_THROW(myparallel_for(pool, 100, workers, 4, [](int&, std::size_t i) {
+        if (i==50) {
+            throw std::runtime_error("task failed");
+        }
+    }), std::runtime_error);
+    std::atomic<int> done(0);
+    myparallel_for(pool, 100, workers, 4, [&done](int& worker, std::size_t) {
+        ++worker;
+        ++done;
+    });
+    CPPUNIT_ASSERT_EQUAL(done.load(), 100);
+}
+
+///Tests myalign_global() myalign_local() and their score-only versions
+void myalgorithmstest :: myalignTest (void) {
+    const std::string a("GUMBO");
+    const std::string b("GAMBOL");
+    const MyMatchScore score(2,-1);
+
+    MyAlignment global = myalign_global(a.begin(), a.end(), b.begin(), b.end(), score, 3, 1);
+    ///G-G U-A M-M B-B O-O then L inserted: 4*2-1-(3+1)
+    CPPUNIT_ASSERT_EQUAL(global.score, 3);
+    CPPUNIT_ASSERT_EQUAL(global.script.size(), static_cast<std::size_t>(6));
+    CPPUNIT_ASSERT(global.script[1]==MyAlignment::MISMATCH);
+    CPPUNIT_ASSERT(global.script[5]==MyAlignment::INSERT);
+    CPPUNIT_ASSERT_EQUAL(global.edits(), static_cast<std::size_t>(2));
+    CPPUNIT_ASSERT_EQUAL(myalign_global_score(a.begin(), a.end(), b.begin(), b.end(), score, 3, 1), 3);
+
+    ///A single gap is cheaper than two
+    const std::string c("AAAACCCCGGGGTTTT");
+    const std::string d("AAAAGGGGTTTT");
+    global = myalign_global(c.begin(), c.end(), d.begin(), d.end(), score, 5, 1);
+    CPPUNIT_ASSERT_EQUAL(global.score, 12*2-(5+4));
+    CPPUNIT_ASSERT_EQUAL(global.edits(), static_cast<std::size_t>(4));
+    CPPUNIT_ASSERT(myfind(global.script.begin(), global.script.end(), MyAlignment::MISMATCH)==global.script.end());
+    CPPUNIT_ASSERT_EQUAL(myalign_global_score(c.begin(), c.end(), d.begin(), d.end(), score, 5, 1), global.score);
+
+    ///The local alignment finds the common core
+    const std::string e("xxxxGATTACAyyyy");
+    const std::string f("zzGATTACAzz");
+    MyAlignment local = myalign_local(e.begin(), e.end(), f.begin(), f.end(), score, 3, 1);
+    CPPUNIT_ASSERT_EQUAL(local.score, 14);
+    CPPUNIT_ASSERT_EQUAL(local.first, static_cast<std::size_t>(4));
+    CPPUNIT_ASSERT_EQUAL(local.last, static_cast<std::size_t>(11));
+    CPPUNIT_ASSERT_EQUAL(local.first2, static_cast<std::size_t>(2));
+    CPPUNIT_ASSERT_EQUAL(local.edits(), static_cast<std::size_t>(0));
+    CPPUNIT_ASSERT_EQUAL(myalign_local_score(e.begin(), e.end(), f.begin(), f.end(), score, 3, 1), 14);
+
+    ///The score-only versions never step outside a much shorter sequence
+    std::vector<char> ten(10, 'A');
+    std::vector<char> two(2, 'A');
+    CPPUNIT_ASSERT_EQUAL(myalign_global_score(ten.begin(), ten.end(), two.begin(), two.end(), score, 3, 1),
+                         myalign_global(ten.begin(), ten.end(), two.begin(), two.end(), score, 3, 1).score);
+    CPPUNIT_ASSERT_EQUAL(myalign_global_score(two.begin(), two.end(), ten.begin(), ten.end(), score, 3, 1),
+                         myalign_global(two.begin(), two.end(), ten.begin(), ten.end(), score, 3, 1).score);
+    CPPUNIT_ASSERT_EQUAL(myalign_local_score(ten.begin(), ten.end(), two.begin(), two.end(), score, 3, 1), 4);
+
+    ///Any random access sequences: words of two vectors
+    MyVector<std::string> w(v.begin(), v.end());
+    w.erase(w.begin()+3);
+    global = myalign_global(v.begin(), v.end(), w.begin(), w.end(), score, 3, 1);
+    CPPUNIT_ASSERT_EQUAL(global.edits(), static_cast<std::size_t>(1));
+    CPPUNIT_ASSERT(global.script[3]==MyAlignment::DELETE);
+    CPPUNIT_ASSERT(myalign_local(a.begin(), a.end(), c.begin(), c.end(), MyMatchScore(1,-5), 3, 1).script.size()==1);
+}
@@ -8,8 +8,18 @@
 #include <cppunit/extensions/HelperMacros.h>
 
 #include <iostream>
+#include <list>
+#include <algorithm>
+#include <cstdio>
 #include <fstream>
+#include <functional>
+#include <sstream>
+#include <thread>
+#include <iterator>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "mystl.h"
 
@@ -26,6 +36,15 @@ class mylisttest : public CPPUNIT_NS :: TestFixture {
     CPPUNIT_TEST (iteratorTest);
     CPPUNIT_TEST (reverse_iteratorTest);
     CPPUNIT_TEST (exceptionTest);
+    CPPUNIT_TEST (emplaceTest);
+    CPPUNIT_TEST (slabTest);
+    CPPUNIT_TEST (teardownTest);
+    CPPUNIT_TEST (swapTest);
+    CPPUNIT_TEST (spliceTest);
+    CPPUNIT_TEST (mergeTest);
+    CPPUNIT_TEST (sortTest);
+    CPPUNIT_TEST (uniqueTest);
+    CPPUNIT_TEST (saveTest);
     CPPUNIT_TEST_SUITE_END ();
 
 public:
@@ -53,6 +72,24 @@ protected:
     void reverse_iteratorTest (void);
     ///Test exceptional behaviour
     void exceptionTest (void);
+    ///Tests emplace_front() emplace_back() and the rvalue push overloads
+    void emplaceTest (void);
+    ///Tests reserve_nodes() and the recycling of deleted elements
+    void slabTest (void);
+    ///Tests that deleting a very long list does not exhaust the stack
+    void teardownTest (void);
+    ///Tests swap()
+    void swapTest (void);
+    ///Tests the splice() methods
+    void spliceTest (void);
+    ///Tests the merge() methods
+    void mergeTest (void);
+    ///Tests the sort() methods
+    void sortTest (void);
+    ///Tests unique() and remove_if()
+    void uniqueTest (void);
+    ///Tests save() and load()
+    void saveTest (void);
 
 private:
     mystl::MyList<std::string> l;
@@ -73,6 +110,19 @@ class myvectortest : public CPPUNIT_NS :: TestFixture {
     CPPUNIT_TEST (iteratorTest);
     CPPUNIT_TEST (reverse_iteratorTest);
     CPPUNIT_TEST (exceptionTest);
+    CPPUNIT_TEST (random_accessTest);
+    CPPUNIT_TEST (const_iteratorTest);
+    CPPUNIT_TEST (emplaceTest);
+    CPPUNIT_TEST (moveTest);
+    CPPUNIT_TEST (growthTest);
+    CPPUNIT_TEST (trivialTest);
+    CPPUNIT_TEST (policyTest);
+    CPPUNIT_TEST (shrinkTest);
+    CPPUNIT_TEST (rangeTest);
+    CPPUNIT_TEST (insertTest);
+    CPPUNIT_TEST (eraseTest);
+    CPPUNIT_TEST (saveTest);
+    CPPUNIT_TEST (alignTest);
     CPPUNIT_TEST_SUITE_END ();
 
 public:
@@ -100,12 +150,296 @@ protected:
     void reverse_iteratorTest (void);
     ///Test exceptional behaviour
     void exceptionTest (void);
+    ///Tests the random access operators of iterator and the Standard algorithms on it
+    void random_accessTest (void);
+    ///Tests const_iterator and const_reverse_iterator classes
+    void const_iteratorTest (void);
+    ///Tests emplace_back() and the rvalue push_back overload
+    void emplaceTest (void);
+    ///Tests move constructor and move assignment
+    void moveTest (void);
+    ///Tests that growth relocates elements without copying them
+    void growthTest (void);
+    ///Tests the bytewise copy and the in place growth of trivially copyable elements
+    void trivialTest (void);
+    ///Tests the growth policies
+    void policyTest (void);
+    ///Tests shrink_to_fit() method
+    void shrinkTest (void);
+    ///Tests the range constructor and assign()
+    void rangeTest (void);
+    ///Tests insert() of a range
+    void insertTest (void);
+    ///Tests erase() methods
+    void eraseTest (void);
+    ///Tests save() and load()
+    void saveTest (void);
+    ///Tests the aligned storage, the padding of the capacity and data()
+    void alignTest (void);
 
 private:
     mystl::MyVector<std::string> v;
     mystl::MyVector<std::string> emptyv;
 };
 
+///\class myunrolledlisttest
+///\brief Tests MyUnrolledList class
+class myunrolledlisttest : public CPPUNIT_NS :: TestFixture {
+    CPPUNIT_TEST_SUITE (myunrolledlisttest);
+    CPPUNIT_TEST (constructorTest);
+    CPPUNIT_TEST (ppfTest);
+    CPPUNIT_TEST (ppbTest);
+    CPPUNIT_TEST (iteratorTest);
+    CPPUNIT_TEST (insertTest);
+    CPPUNIT_TEST (eraseTest);
+    CPPUNIT_TEST (exceptionTest);
+    CPPUNIT_TEST_SUITE_END ();
+
+public:
+    ///Prepares the test environment
+    void setUp (void);
+    ///Cleanes the test environment
+    void tearDown (void);
+
+protected:
+    ///Tests the copy constructor and the operator =
+    void constructorTest (void);
+    ///Tests push_front() pop_front() and front() methods
+    void ppfTest (void);
+    ///Tests push_back() pop_back() and back() methods
+    void ppbTest (void);
+    ///Tests iterator and reverse_iterator classes
+    void iteratorTest (void);
+    ///Tests insert() against a std::list
+    void insertTest (void);
+    ///Tests erase() against a std::list
+    void eraseTest (void);
+    ///Test exceptional behaviour
+    void exceptionTest (void);
+
+private:
+    mystl::MyUnrolledList<std::string,4> l;
+    mystl::MyUnrolledList<std::string,4> emptyl;
+};
+
+///\brief An object that can stay in two intrusive lists at the same time
+struct Task {
+    Task(int i=0) : id(i) {}
+    int id;
+    mystl::MyListHook run;
+    mystl::MyListHook lru;
+};
+
+///\class myintrusivelisttest
+///\brief Tests MyIntrusiveList class
+class myintrusivelisttest : public CPPUNIT_NS :: TestFixture {
+    CPPUNIT_TEST_SUITE (myintrusivelisttest);
+    CPPUNIT_TEST (ppTest);
+    CPPUNIT_TEST (iteratorTest);
+    CPPUNIT_TEST (eraseTest);
+    CPPUNIT_TEST (exceptionTest);
+    CPPUNIT_TEST_SUITE_END ();
+
+public:
+    ///Prepares the test environment
+    void setUp (void);
+    ///Cleanes the test environment
+    void tearDown (void);
+
+protected:
+    ///Tests push_front() push_back() pop_front() pop_back() front() and back() methods
+    void ppTest (void);
+    ///Tests iterator and reverse_iterator classes
+    void iteratorTest (void);
+    ///Tests insert() and erase() and the membership in two lists
+    void eraseTest (void);
+    ///Test exceptional behaviour
+    void exceptionTest (void);
+
+private:
+    Task tasks[5];
+    mystl::MyIntrusiveList<Task,&Task::run> runq;
+    mystl::MyIntrusiveList<Task,&Task::lru> lru;
+};
+
+///\class mysmallvectortest
+///\brief Tests MySmallVector class
+class mysmallvectortest : public CPPUNIT_NS :: TestFixture {
+    CPPUNIT_TEST_SUITE (mysmallvectortest);
+    CPPUNIT_TEST (inlineTest);
+    CPPUNIT_TEST (constructorTest);
+    CPPUNIT_TEST (moveTest);
+    CPPUNIT_TEST_SUITE_END ();
+
+public:
+    ///Prepares the test environment
+    void setUp (void);
+    ///Cleanes the test environment
+    void tearDown (void);
+
+protected:
+    ///Tests the switch from the inline buffer to the heap
+    void inlineTest (void);
+    ///Tests the copy constructors and the operator =
+    void constructorTest (void);
+    ///Tests move constructor and move assignment in both storage modes
+    void moveTest (void);
+
+private:
+    mystl::MySmallVector<std::string,4> sv;
+};
+
+///\class mymappedvectortest
+///\brief Tests MyMappedVector class
+class mymappedvectortest : public CPPUNIT_NS :: TestFixture {
+    CPPUNIT_TEST_SUITE (mymappedvectortest);
+    CPPUNIT_TEST (recordTest);
+    CPPUNIT_TEST (stringTest);
+    CPPUNIT_TEST (formatTest);
+    CPPUNIT_TEST_SUITE_END ();
+
+public:
+    ///Prepares the test environment
+    void setUp (void);
+    ///Cleanes the test environment
+    void tearDown (void);
+
+protected:
+    ///Tests a file of fixed-size elements
+    void recordTest (void);
+    ///Tests a file of strings
+    void stringTest (void);
+    ///Tests the rejection of invalid files
+    void formatTest (void);
+
+private:
+    std::string fileName;
+};
+
+///\class myconcurrentvectortest
+///\brief Tests MyConcurrentVector class
+class myconcurrentvectortest : public CPPUNIT_NS :: TestFixture {
+    CPPUNIT_TEST_SUITE (myconcurrentvectortest);
+    CPPUNIT_TEST (ppbTest);
+    CPPUNIT_TEST (iteratorTest);
+    CPPUNIT_TEST (grow_byTest);
+    CPPUNIT_TEST (exceptionTest);
+    CPPUNIT_TEST (threadTest);
+    CPPUNIT_TEST_SUITE_END ();
+
+public:
+    ///Prepares the test environment
+    void setUp (void);
+    ///Cleanes the test environment
+    void tearDown (void);
+
+protected:
+    ///Tests push_back() and the stability of the addresses
+    void ppbTest (void);
+    ///Tests iterator and const_iterator classes
+    void iteratorTest (void);
+    ///Tests grow_by() methods
+    void grow_byTest (void);
+    ///Tests the failed appends
+    void exceptionTest (void);
+    ///Tests threads appending and reading at the same time
+    void threadTest (void);
+
+private:
+    mystl::MyConcurrentVector<std::string> v;
+};
+
+///\class mysoavectortest
+///\brief Tests MySoAVector class
+class mysoavectortest : public CPPUNIT_NS :: TestFixture {
+    CPPUNIT_TEST_SUITE (mysoavectortest);
+    CPPUNIT_TEST (ppbTest);
+    CPPUNIT_TEST (columnTest);
+    CPPUNIT_TEST (iteratorTest);
+    CPPUNIT_TEST_SUITE_END ();
+
+public:
+    ///Prepares the test environment
+    void setUp (void);
+    ///Cleanes the test environment
+    void tearDown (void);
+
+protected:
+    ///Tests push_back() emplace_back() pop_back() and the access to the records
+    void ppbTest (void);
+    ///Tests column() and the algorithms on a single column
+    void columnTest (void);
+    ///Tests iterator and const_iterator classes
+    void iteratorTest (void);
+
+private:
+    ///A record made of id, score and flags
+    typedef mystl::MySoAVector<int,double,std::string> Records;
+    Records records;
+};
+
+///\class mydequetest
+///\brief Tests MyDeque class
+class mydequetest : public CPPUNIT_NS :: TestFixture {
+    CPPUNIT_TEST_SUITE (mydequetest);
+    CPPUNIT_TEST (ppbTest);
+    CPPUNIT_TEST (stableTest);
+    CPPUNIT_TEST (queueTest);
+    CPPUNIT_TEST (iteratorTest);
+    CPPUNIT_TEST (copyTest);
+    CPPUNIT_TEST_SUITE_END ();
+
+public:
+    ///Prepares the test environment
+    void setUp (void);
+    ///Cleanes the test environment
+    void tearDown (void);
+
+protected:
+    ///Tests push_front() push_back() pop_front() pop_back()
+    void ppbTest (void);
+    ///Tests that the elements are never moved while the deque grows
+    void stableTest (void);
+    ///Tests a deque used as a queue, moving through many blocks
+    void queueTest (void);
+    ///Tests iterator and const_iterator classes
+    void iteratorTest (void);
+    ///Tests the copy and the move of a deque
+    void copyTest (void);
+
+private:
+    ///Small blocks, so that the tests cross many of them
+    mystl::MyDeque<int,4> deque;
+    mystl::MyDeque<std::string,3> sdeque;
+};
+
+///\class myallocatortest
+///\brief Tests MySTL allocators
+class myallocatortest : public CPPUNIT_NS :: TestFixture {
+    CPPUNIT_TEST_SUITE (myallocatortest);
+    CPPUNIT_TEST (arenaTest);
+    CPPUNIT_TEST (poolTest);
+    CPPUNIT_TEST (mmapTest);
+    CPPUNIT_TEST (containerTest);
+    CPPUNIT_TEST_SUITE_END ();
+
+public:
+    ///Prepares the test environment
+    void setUp (void);
+    ///Cleanes the test environment
+    void tearDown (void);
+
+protected:
+    ///Tests MyArena and MyArenaAllocator
+    void arenaTest (void);
+    ///Tests MyPool and MyPoolAllocator
+    void poolTest (void);
+    ///Tests MyMmapAllocator
+    void mmapTest (void);
+    ///Tests containers sharing or not sharing an allocator
+    void containerTest (void);
+};
+
 ///\class myalgorithmstest
 ///\brief Tests MySTL algorithms
 class myalgorithmstest : public CPPUNIT_NS :: TestFixture {
@@ -113,7 +447,12 @@ class myalgorithmstest : public CPPUNIT_NS :: TestFixture {
     CPPUNIT_TEST (myfindTest);
     CPPUNIT_TEST (myequalTest);
     CPPUNIT_TEST (mysearchTest);
+    CPPUNIT_TEST (mysearcherTest);
     CPPUNIT_TEST (myldistTest);
+    CPPUNIT_TEST (myldistLongTest);
+    CPPUNIT_TEST (myldistBoundedTest);
+    CPPUNIT_TEST (myldistBatchTest);
+    CPPUNIT_TEST (myalignTest);
     CPPUNIT_TEST_SUITE_END ();
 
 public:
@@ -129,8 +468,18 @@ protected:
     void myequalTest (void);
     ///Tests mysearch() method
     void mysearchTest (void);
+    ///Tests mysearch() with MyKmpSearcher and MyHorspoolSearcher
+    void mysearcherTest (void);
     ///Tests myldist() method
     void myldistTest (void);
+    ///Tests myldist() on sequences longer than a block of Myers' algorithm
+    void myldistLongTest (void);
+    ///Tests myldist_bounded() method
+    void myldistBoundedTest (void);
+    ///Tests myldist_batch() and myldist_nearest() methods
+    void myldistBatchTest (void);
+    ///Tests myalign_global() myalign_local() and their score-only versions
+    void myalignTest (void);
 
 private:
     mystl::MyVector<std::string> v;
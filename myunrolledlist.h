@@ -0,0 +1,555 @@
+///\file myunrolledlist.h
+///\brief The unrolled list container
+///
+///It contains implementation of a double linked list of small arrays with the relative operators and iterators
+
+#ifndef MYSTL_MYUNROLLEDLIST_H
+#define MYSTL_MYUNROLLEDLIST_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "myallocator.h"
+
+///Isolates MySTL Classes and functions names
+namespace mystl {
+
+///\class MyUnrolledList
+///\brief A double linked list whose nodes hold up to B elements each
+///
+///It offers the interface of MyList, but a scan follows one pointer every B elements
+///and reads the others from contiguous memory. Elements can be inserted or deleted
+///anywhere in O(B): only the node involved is rearranged, full nodes are split in two
+///and nodes left almost empty are merged with the following one.
+///It contains 3 inner classes: Node, iterator and reverse_iterator
+template<class T, int B = 16, class Alloc = MyAllocator<T> >
+class MyUnrolledList {
+    static_assert(B>1, "A node of MyUnrolledList must hold at least two elements");
+
+private:
+
+    ///\class Node
+    ///\brief A node of the list: the elements occupy the slots [first, first+count)
+    class Node {
+    public:
+        Node(): next(0), prev(0), first(0), count(0) {}
+        ///Returnes the slots of the node
+        T* elems() {
+            return(reinterpret_cast<T*>(storage));
+        }
+        ///The next node in the list
+        Node* next;
+        ///The previous node in the list
+        Node* prev;
+        ///The slot of the first element
+        int first;
+        ///The number of elements
+        int count;
+    private:
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage[B];
+    };
+
+    ///The first node of the list
+    Node* _front;
+    ///The last node of the list
+    Node* _back;
+    ///The size of the list
+    int _size;
+
+    //typename is required for the compiler to know what we mean cfr.:Stourstrup C.13.5
+    typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node> NodeAlloc;
+
+    ///The allocator providing the nodes
+    NodeAlloc _alloc;
+
+    ///Allocates an empty node and links it after prev (at the beginning of the list if prev is 0)
+    Node* create_node(Node* prev) {
+        Node* n = _alloc.allocate(1);
+        new (n) Node();
+        n->prev=prev;
+        n->next = prev==0 ? _front : prev->next;
+        if (n->next==0) {
+            _back=n;
+        } else {
+            n->next->prev=n;
+        }
+        if (prev==0) {
+            _front=n;
+        } else {
+            prev->next=n;
+        }
+        return(n);
+    }
+
+    ///Unlinks an empty node and gives it back to the allocator
+    void destroy_node(Node* n) {
+        if (n->prev==0) {
+            _front=n->next;
+        } else {
+            n->prev->next=n->next;
+        }
+        if (n->next==0) {
+            _back=n->prev;
+        } else {
+            n->next->prev=n->prev;
+        }
+        n->~Node();
+        _alloc.deallocate(n,1);
+    }
+
+    ///Moves the elements in the slots [from, from+count) of a node to the slots starting at to,
+    ///the ranges can overlap
+    static void shift(T* e, int from, int to, int count) {
+        if (to<from) {
+            for (int k=0; k<count; ++k) {
+                new (e+to+k) T(std::move(e[from+k]));
+                e[from+k].~T();
+            }
+        } else if (to>from) {
+            for (int k=count-1; k>=0; --k) {
+                new (e+to+k) T(std::move(e[from+k]));
+                e[from+k].~T();
+            }
+        }
+    }
+
+    ///Makes room for one element before the logical position r of a non full node, returnes its slot
+    static int open_slot(Node* n, int r) {
+        T* e=n->elems();
+        if (n->first+n->count<B) {
+            shift(e, n->first+r, n->first+r+1, n->count-r);
+        } else {
+            shift(e, n->first, n->first-1, r);
+            --n->first;
+        }
+        ++n->count;
+        return(n->first+r);
+    }
+
+    ///Splits a full node moving its upper half into a new node that follows it
+    void split(Node* n) {
+        Node* m=create_node(n);
+        const int keep=B/2;
+        for (int k=keep; k<n->count; ++k) {
+            new (m->elems()+k-keep) T(std::move(n->elems()[n->first+k]));
+            n->elems()[n->first+k].~T();
+        }
+        m->count=n->count-keep;
+        n->count=keep;
+    }
+
+    ///Appends the elements of the node following n to n and deletes it, they must fit
+    void absorb_next(Node* n) {
+        Node* m=n->next;
+        if (n->first+n->count+m->count>B) {
+            shift(n->elems(), n->first, 0, n->count);
+            n->first=0;
+        }
+        for (int k=0; k<m->count; ++k) {
+            new (n->elems()+n->first+n->count+k) T(std::move(m->elems()[m->first+k]));
+            m->elems()[m->first+k].~T();
+        }
+        n->count+=m->count;
+        m->count=0;
+        destroy_node(m);
+    }
+
+public:
+    ///\class iterator
+    ///\brief A bidirectional iterator for MyUnrolledList
+    ///
+    ///end() points to the slot after the last element of the last node
+    class iterator {
+    private:
+        Node* node;
+        int slot;
+        friend class MyUnrolledList;
+
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T* pointer;
+        typedef T& reference;
+
+        iterator() : node(0), slot(0) {}
+        ///Creates an iterator from a node and a slot
+        iterator(Node* n, int s) : node(n), slot(s) {}
+
+        ///Operator ==
+        bool operator==(const iterator& other) const {
+            return(node == other.node && slot == other.slot);
+        }
+
+        ///Operator !=
+        bool operator!=(const iterator& other) const {
+            return(!(*this == other));
+        }
+
+        ///Operator ++ (prefix)
+        iterator& operator++() {
+            ++slot;
+            if (slot == node->first+node->count && node->next != 0) {
+                node = node->next;
+                slot = node->first;
+            }
+            return(*this);
+        }
+
+        ///Operator ++ (postfix)
+        iterator operator++(int) {
+            iterator tmp(*this);
+            ++(*this);
+            return(tmp);
+        }
+
+        ///Operator -- (prefix)
+        iterator& operator--() {
+            if (slot == node->first && node->prev != 0) {
+                node = node->prev;
+                slot = node->first+node->count;
+            }
+            --slot;
+            return(*this);
+        }
+
+        ///Operator -- (postfix)
+        iterator operator--(int) {
+            iterator tmp(*this);
+            --(*this);
+            return(tmp);
+        }
+
+        ///Operator *: returns by reference
+        T& operator*() const {
+            return(node->elems()[slot]);
+        }
+
+        ///Operator ->
+        T* operator->() const {
+            return(node->elems()+slot);
+        }
+    };
+
+    ///\class reverse_iterator
+    ///\brief A reverse iterator for MyUnrolledList
+    ///
+    ///rend() points to the slot before the first element of the first node
+    class reverse_iterator {
+    private:
+        iterator it;
+
+    public:
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T* pointer;
+        typedef T& reference;
+
+        reverse_iterator() {}
+        ///Creates a reverse_iterator from a node and a slot
+        reverse_iterator(Node* n, int s) : it(n,s) {}
+
+        ///Operator ==
+        bool operator==(const reverse_iterator& other) const {
+            return(it == other.it);
+        }
+
+        ///Operator !=
+        bool operator!=(const reverse_iterator& other) const {
+            return(it != other.it);
+        }
+
+        ///Operator ++ (prefix)
+        reverse_iterator& operator++() {
+            --it;
+            return(*this);
+        }
+
+        ///Operator ++ (postfix)
+        reverse_iterator operator++(int) {
+            reverse_iterator tmp(*this);
+            --it;
+            return(tmp);
+        }
+
+        ///Operator -- (prefix)
+        reverse_iterator& operator--() {
+            ++it;
+            return(*this);
+        }
+
+        ///Operator -- (postfix)
+        reverse_iterator operator--(int) {
+            reverse_iterator tmp(*this);
+            ++it;
+            return(tmp);
+        }
+
+        ///Operator *: returns by reference
+        T& operator*() const {
+            return(*it);
+        }
+
+        ///Operator ->
+        T* operator->() const {
+            return(&*it);
+        }
+    };
+
+    ///Creates an empty list whose nodes will be obtained from alloc
+    MyUnrolledList(const Alloc& alloc=Alloc()) : _front(0), _back(0), _size(0), _alloc(alloc) {}
+
+    ///Creates a list from another one using the operator=, the allocator is copied too
+    MyUnrolledList(const MyUnrolledList& other) : _front(0), _back(0), _size(0), _alloc(other._alloc) {
+        *this=other;
+    }
+
+    ///Operator= Copy element by element
+    MyUnrolledList& operator=(const MyUnrolledList& other) {
+        if (this!=&other) {
+            clear();
+            for (Node* n = other._front; n != 0; n = n->next) {
+                for (int k = n->first; k < n->first+n->count; ++k) {
+                    push_back(n->elems()[k]);
+                }
+            }
+        }
+        return(*this);
+    }
+
+    ///Deletes a list after clearing his content
+    ~MyUnrolledList() {
+        clear();
+    }
+
+    ///Returnes TRUE if the list is empty
+    bool empty() const {
+        return(_size==0);
+    }
+
+    ///Returnes the size of the list
+    int size() const {
+        return(_size);
+    }
+
+    ///Deletes the content of the list
+    void clear() {
+        while (_front!=0) {
+            T* e=_front->elems();
+            for (int k = _front->first; k < _front->first+_front->count; ++k) {
+                e[k].~T();
+            }
+            _front->count=0;
+            destroy_node(_front);
+        }
+        _size=0;
+    }
+
+    ///Returnes the value of the first element of the list
+    T front() {
+        if(_size==0) {
+            throw std::out_of_range("Empty List");
+        } else {
+            return(_front->elems()[_front->first]);
+        }
+    }
+
+    ///Returnes the value of the last element of the list
+    T back() {
+        if(_size==0) {
+            throw std::out_of_range("Empty List");
+        } else {
+            return(_back->elems()[_back->first+_back->count-1]);
+        }
+    }
+
+    ///Constructs an element at the beginning of the list forwarding args to its constructor
+    template<class... Args>
+    void emplace_front(Args&&... args) {
+        Node* n=_front;
+        if (n==0 || n->first==0) {
+            if (n==0 || n->count==B) {
+                //a new front node is filled from its end, so the next insertions do not shift
+                n=create_node(0);
+                n->first=B;
+            } else {
+                shift(n->elems(), n->first, B-n->count, n->count);
+                n->first=B-n->count;
+            }
+        }
+        try {
+            new (n->elems()+n->first-1) T(std::forward<Args>(args)...);
+        } catch (...) {
+            if (n->count==0) {
+                destroy_node(n);
+            }
+            throw;
+        }
+        --n->first;
+        ++n->count;
+        ++_size;
+    }
+
+    ///Constructs an element at the end of the list forwarding args to its constructor
+    template<class... Args>
+    void emplace_back(Args&&... args) {
+        Node* n=_back;
+        if (n==0 || n->first+n->count==B) {
+            if (n==0 || n->count==B) {
+                n=create_node(_back);
+            } else {
+                shift(n->elems(), n->first, 0, n->count);
+                n->first=0;
+            }
+        }
+        try {
+            new (n->elems()+n->first+n->count) T(std::forward<Args>(args)...);
+        } catch (...) {
+            if (n->count==0) {
+                destroy_node(n);
+            }
+            throw;
+        }
+        ++n->count;
+        ++_size;
+    }
+
+    ///Inserts an element at the beginning of the list
+    void push_front(const T& val) {
+        emplace_front(val);
+    }
+
+    ///Inserts an element at the beginning of the list moving it in place
+    void push_front(T&& val) {
+        emplace_front(std::move(val));
+    }
+
+    ///Inserts an element at the end of the list
+    void push_back(const T& val) {
+        emplace_back(val);
+    }
+
+    ///Inserts an element at the end of the list moving it in place
+    void push_back(T&& val) {
+        emplace_back(std::move(val));
+    }
+
+    ///Deletes an element at the beginning of the list
+    void pop_front() {
+        if(_size==0) {
+            throw std::out_of_range("Empty List");
+        } else {
+            _front->elems()[_front->first].~T();
+            ++_front->first;
+            --_front->count;
+            --_size;
+            if (_front->count==0) {
+                destroy_node(_front);
+            }
+        }
+    }
+
+    ///Deletes an element at the end of the list
+    void pop_back() {
+        if(_size==0) {
+            throw std::out_of_range("Empty List");
+        } else {
+            --_back->count;
+            _back->elems()[_back->first+_back->count].~T();
+            --_size;
+            if (_back->count==0) {
+                destroy_node(_back);
+            }
+        }
+    }
+
+    ///Constructs an element before pos in O(B), returnes an iterator to it
+    template<class... Args>
+    iterator emplace(iterator pos, Args&&... args) {
+        if (pos==end()) {
+            emplace_back(std::forward<Args>(args)...);
+            return(iterator(_back, _back->first+_back->count-1));
+        }
+        //args could refer to an element that is going to be shifted
+        T val(std::forward<Args>(args)...);
+        Node* n=pos.node;
+        int r=pos.slot-n->first;
+        if (n->count==B) {
+            split(n);
+            if (r>n->count) {
+                r-=n->count;
+                n=n->next;
+            }
+        }
+        const int slot=open_slot(n,r);
+        new (n->elems()+slot) T(std::move(val));
+        ++_size;
+        return(iterator(n,slot));
+    }
+
+    ///Inserts an element before pos in O(B), returnes an iterator to it
+    iterator insert(iterator pos, const T& val) {
+        return(emplace(pos,val));
+    }
+
+    ///Inserts an element before pos moving it in place, returnes an iterator to it
+    iterator insert(iterator pos, T&& val) {
+        return(emplace(pos,std::move(val)));
+    }
+
+    ///Deletes the element at pos in O(B), returnes an iterator to the following one
+    iterator erase(iterator pos) {
+        Node* n=pos.node;
+        const int r=pos.slot-n->first;
+        T* e=n->elems();
+        e[pos.slot].~T();
+        //close the gap moving the shorter side
+        if (r<n->count/2) {
+            shift(e, n->first, n->first+1, r);
+            ++n->first;
+        } else {
+            shift(e, pos.slot+1, pos.slot, n->count-r-1);
+        }
+        --n->count;
+        --_size;
+        if (n->count==0) {
+            Node* next=n->next;
+            destroy_node(n);
+            return(next==0 ? end() : iterator(next,next->first));
+        }
+        //keep the nodes dense, so that scans stay close to contiguous speed
+        if (n->next!=0 && n->count<B/4 && n->count+n->next->count<=B) {
+            absorb_next(n);
+        }
+        if (r<n->count) {
+            return(iterator(n,n->first+r));
+        }
+        return(n->next==0 ? end() : iterator(n->next,n->next->first));
+    }
+
+    ///Creates an iterator pointing to the first element of the list
+    iterator begin() {
+        return(_front==0 ? iterator() : iterator(_front,_front->first));
+    }
+    ///Creates an iterator pointing after the end of the list
+    iterator end() {
+        return(_back==0 ? iterator() : iterator(_back,_back->first+_back->count));
+    }
+    ///Creates a reverse_iterator pointing to the last element of the list
+    reverse_iterator rbegin() {
+        return(_back==0 ? reverse_iterator() : reverse_iterator(_back,_back->first+_back->count-1));
+    }
+    ///Creates a reverse_iterator pointing before the beginning of the list
+    reverse_iterator rend() {
+        return(_front==0 ? reverse_iterator() : reverse_iterator(_front,_front->first-1));
+    }
+};
+
+}
+#endif
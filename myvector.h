@@ -6,66 +6,460 @@
 #ifndef MYSTL_MYVECTOR_H
 #define MYSTL_MYVECTOR_H
 
-#define DEFAULT_CAPACITY 10
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "myallocator.h"
+#include "myserializer.h"
 
 ///Isolates MySTL Classes and functions names
 namespace mystl {
 
+///\class MyDoublingGrowth
+///\brief The default growth policy of MyVector: the capacity starts at 10 elements and doubles
+///
+///A growth policy is a class with a static next_capacity() method returning the capacity
+///that follows the current one when the vector is full (the vector asks at least one more element)
+class MyDoublingGrowth {
+public:
+    static std::size_t next_capacity(std::size_t capacity) {
+        return(capacity==0 ? 10 : 2*capacity);
+    }
+};
+
+///\class MyHalfGrowth
+///\brief A growth policy that enlarges the capacity by one half, trading some more reallocations for less slack
+class MyHalfGrowth {
+public:
+    static std::size_t next_capacity(std::size_t capacity) {
+        return(capacity<2 ? capacity+2 : capacity+capacity/2);
+    }
+};
+
+///\class MyChunkGrowth
+///\brief A growth policy that adds Chunk elements at a time, the slack never exceeds Chunk-1 elements
+template<std::size_t Chunk>
+class MyChunkGrowth {
+    static_assert(Chunk>0, "MyChunkGrowth needs a positive chunk");
+
+public:
+    static std::size_t next_capacity(std::size_t capacity) {
+        return(capacity+Chunk);
+    }
+};
+
+///Returnes the greatest common divisor of a and b
+constexpr std::size_t mygcd(std::size_t a, std::size_t b) {
+    return(b==0 ? a : mygcd(b, a%b));
+}
+
 ///\class MyVector
 ///\brief A vector (dynamic array) class
 ///
 ///This class is meant as a programming exercise, It mimcs std::vector behaviour.
-///It contains 2 inner classes: iterator and reverse_iterator
+///It contains 2 inner class templates: basic_iterator and basic_reverse_iterator,
+///instantiated as iterator, const_iterator, reverse_iterator and const_reverse_iterator
+///The storage is obtained from an allocator of type Alloc (MyAllocator by default)
+///and grows as dictated by the policy Growth (MyDoublingGrowth by default)
 ///
 ///\author Mauro Baluda
 ///Contact: mauro@bglug.it
-template<class T>
+template<class T, class Alloc = MyAllocator<T>, class Growth = MyDoublingGrowth>
 class MyVector {
 
 private:
     ///The capacity of the vector
-    int _capacity;
+    std::size_t _capacity;
 
     ///The size of the vector (number of elements contained)
-    int _size;
+    std::size_t _size;
 
     ///The actual vector content
-    T* data;
+    T* _data;
+
+    ///An inline buffer provided by a derived class (MySmallVector), 0 if there is none.
+    ///It is never deallocated and _data points to it until the content outgrows it
+    T* _inline;
+
+    ///The capacity of the inline buffer
+    std::size_t _inline_capacity;
+
+    ///The allocator providing the storage
+    Alloc _alloc;
+
+    ///Allocates uninitialized storage for n elements
+    T* allocate(std::size_t n) {
+        return(n>0 ? _alloc.allocate(n) : 0);
+    }
+
+    ///Releases storage for n elements obtained from allocate()
+    void deallocate(T* p, std::size_t n) {
+        if (p!=0) {
+            _alloc.deallocate(p,n);
+        }
+    }
+
+    ///TRUE if elements can be copied and relocated bytewise
+    static const bool trivial = std::is_trivially_copyable<T>::value;
+
+    ///TRUE if the heap buffer can be grown through Alloc::reallocate instead of a new allocation
+    static const bool reallocatable = trivial && has_reallocate<Alloc>::value;
+
+    ///Destroys the elements in [first,last) without releasing their storage
+    static void destroy(T* first, T* last) {
+        if (std::is_trivially_destructible<T>::value) {
+            return;
+        }
+        for(;first!=last;++first) {
+            first->~T();
+        }
+    }
+
+    ///Copy-constructs the elements of [first,last) into the raw storage at dest,
+    ///trivially copyable elements are copied with a single memcpy
+    static void uninitialized_copy(const T* first, const T* last, T* dest) {
+        if (trivial) {
+            if (first!=last) {
+                std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), (last-first)*sizeof(T));
+            }
+            return;
+        }
+        T* cur=dest;
+        try {
+            for(;first!=last;++first,++cur) {
+                new (cur) T(*first);
+            }
+        } catch (...) {
+            destroy(dest,cur);
+            throw;
+        }
+    }
+
+    ///Moves the content to temp, a new buffer of new_capacity elements, and releases the old one.
+    ///Elements are copied instead when their move constructor could throw, so a failure leaves _data untouched.
+    ///Trivially copyable elements are moved with a single memcpy
+    void relocate(T* temp, std::size_t new_capacity) {
+        relocate(temp, new_capacity, _size, 0);
+    }
+
+    ///Like relocate(temp,new_capacity) but leaves gap unconstructed slots in temp before the element at index
+    void relocate(T* temp, std::size_t new_capacity, std::size_t index, std::size_t gap) {
+        if (trivial) {
+            uninitialized_copy(_data,_data+index,temp);
+            uninitialized_copy(_data+index,_data+_size,temp+index+gap);
+        } else {
+            std::size_t i=0;
+            try {
+                for(;i<_size;++i) {
+                    new (temp+i+(i<index ? 0 : gap)) T(std::move_if_noexcept(_data[i]));
+                }
+            } catch (...) {
+                destroy(temp,temp+(i<index ? i : index));
+                if (i>index) {
+                    destroy(temp+index+gap,temp+i+gap);
+                }
+                throw;
+            }
+            destroy(_data,_data+_size);
+        }
+        release();
+        _data=temp;
+        _capacity=new_capacity;
+    }
+
+    ///Returnes TRUE if the heap buffer can be resized in place through Alloc::reallocate
+    bool can_reallocate() const {
+        return(reallocatable && _data!=0 && !is_inline());
+    }
+
+    ///Resizes the heap buffer to new_capacity through Alloc::reallocate, see can_reallocate()
+    void reallocate(std::size_t new_capacity) {
+        reallocate(new_capacity, std::integral_constant<bool,reallocatable>());
+    }
+
+    void reallocate(std::size_t new_capacity, std::true_type) {
+        _data=_alloc.reallocate(_data,_capacity,new_capacity);
+        _capacity=new_capacity;
+    }
+
+    void reallocate(std::size_t, std::false_type) {}
+
+    ///The heap capacity is kept a multiple of this number of elements: the fewest whose size is a multiple
+    ///of the allocator alignment, 1 unless it is larger than the one of T (see MyAlignedAllocator)
+    static const std::size_t padding = allocator_alignment<Alloc>::value/mygcd(allocator_alignment<Alloc>::value, sizeof(T));
+
+    ///Rounds a capacity up to a multiple of padding
+    static std::size_t padded(std::size_t capacity) {
+        return(padding==1 || capacity%padding==0 ? capacity : capacity+padding-capacity%padding);
+    }
+
+    ///Returnes the capacity to grow to when the vector is full: the one suggested by Growth,
+    ///padded, capped at max_size() and anyway larger than the current one
+    std::size_t next_capacity() const {
+        if (_capacity>=max_size()) {
+            throw std::length_error("Vector too long");
+        }
+        const std::size_t new_capacity = padded(Growth::next_capacity(_capacity));
+        return(new_capacity>_capacity && new_capacity<=max_size() ? new_capacity : max_size());
+    }
+
+    ///Returnes the capacity needed to add n elements: the current one if they fit, the exact size
+    ///for an empty vector, otherwise at least the one suggested by Growth so that repeated insertions stay cheap
+    std::size_t capacity_for(std::size_t n) const {
+        if (n>max_size()-_size) {
+            throw std::length_error("Vector too long");
+        }
+        const std::size_t required=_size+n;
+        if (required<=_capacity) {
+            return(_capacity);
+        }
+        if (_size==0) {
+            return(required);
+        }
+        const std::size_t suggested=next_capacity();
+        return(suggested>required ? suggested : required);
+    }
+
+    ///Copy-constructs the elements of [first,last) after the last one, the vector must have room for them.
+    ///The size grows one element at a time so a failure leaves a valid vector
+    template<class In>
+    void construct_at_end(In first, In last) {
+        for(;first!=last;++first) {
+            new (_data+_size) T(*first);
+            ++_size;
+        }
+    }
+
+    ///Appends the elements of a single pass range one at a time
+    template<class In>
+    void append(In first, In last, std::input_iterator_tag) {
+        for(;first!=last;++first) {
+            emplace_back(*first);
+        }
+    }
+
+    ///Appends the elements of a multi pass range, measured first to reserve the storage once
+    template<class For>
+    void append(For first, For last, std::forward_iterator_tag) {
+        reserve(capacity_for(std::distance(first,last)));
+        construct_at_end(first,last);
+    }
+
+    ///Inserts the elements of a single pass range before index: they are appended and then rotated in place
+    template<class In>
+    void insert_range(std::size_t index, In first, In last, std::input_iterator_tag) {
+        const std::size_t old_size=_size;
+        append(first,last,std::input_iterator_tag());
+        std::rotate(_data+index,_data+old_size,_data+_size);
+    }
+
+    ///Inserts the elements of a multi pass range before index.
+    ///If they do not fit they are built in the new buffer and the old elements are relocated around them,
+    ///otherwise the following elements are shifted as a block
+    template<class For>
+    void insert_range(std::size_t index, For first, For last, std::forward_iterator_tag) {
+        const std::size_t n=std::distance(first,last);
+        if (n==0) {
+            return;
+        }
+        const std::size_t new_capacity=capacity_for(n);
+        if (new_capacity>_capacity) {
+            T* temp = allocate(new_capacity);
+            std::size_t built=0;
+            try {
+                for(;first!=last;++first,++built) {
+                    new (temp+index+built) T(*first);
+                }
+            } catch (...) {
+                destroy(temp+index,temp+index+built);
+                deallocate(temp,new_capacity);
+                throw;
+            }
+            try {
+                relocate(temp,new_capacity,index,n);
+            } catch (...) {
+                destroy(temp+index,temp+index+n);
+                deallocate(temp,new_capacity);
+                throw;
+            }
+            _size+=n;
+        } else if (trivial) {
+            std::memmove(static_cast<void*>(_data+index+n), static_cast<const void*>(_data+index), (_size-index)*sizeof(T));
+            for(T* cur=_data+index;first!=last;++first,++cur) {
+                new (cur) T(*first);
+            }
+            _size+=n;
+        } else {
+            const std::size_t old_size=_size;
+            const std::size_t after=old_size-index;
+            if (after>n) {
+                //the last n elements move to raw storage, the others are shifted by assignment
+                for(std::size_t i=old_size-n;i<old_size;++i) {
+                    new (_data+_size) T(std::move(_data[i]));
+                    ++_size;
+                }
+                std::move_backward(_data+index,_data+old_size-n,_data+old_size);
+                std::copy(first,last,_data+index);
+            } else {
+                //the tail of the range and the following elements all land in raw storage
+                For mid=first;
+                std::advance(mid,after);
+                construct_at_end(mid,last);
+                for(std::size_t i=index;i<old_size;++i) {
+                    new (_data+_size) T(std::move(_data[i]));
+                    ++_size;
+                }
+                std::copy(first,mid,_data+index);
+            }
+        }
+    }
+
+    ///Releases the storage pointed by _data unless it is the inline buffer
+    void release() {
+        if (_data!=_inline) {
+            deallocate(_data,_capacity);
+        }
+    }
+
+    ///TRUE for an rvalue of a class derived from MyVector, which may keep its elements inline
+    template<class V>
+    struct derived_rvalue {
+        static const bool value = std::is_base_of<MyVector,V>::value && !std::is_same<MyVector,V>::value && !std::is_reference<V>::value && !std::is_const<V>::value;
+    };
+
+    ///Takes the content of other, which is left empty; this must be empty.
+    ///A heap buffer is stolen, elements kept in an inline buffer or owned by
+    ///a different allocator are moved one by one
+    void steal(MyVector& other) {
+        if (other.is_inline() || !(_alloc==other._alloc)) {
+            if (other._size>_capacity) {
+                reserve(other._size);
+            }
+            for(std::size_t i=0;i<other._size;++i) {
+                new (_data+i) T(std::move(other._data[i]));
+            }
+            _size=other._size;
+            other.clear();
+        } else {
+            release();
+            _capacity=other._capacity;
+            _size=other._size;
+            _data=other._data;
+            other._capacity=other._inline_capacity;
+            other._size=0;
+            other._data=other._inline;
+        }
+    }
+
+protected:
+    ///Creates an empty vector whose first elements are stored in buffer,
+    ///raw storage for capacity elements owned by the caller
+    MyVector(T* buffer, std::size_t capacity, const Alloc& alloc) : _capacity(capacity), _size(0), _data(buffer), _inline(buffer), _inline_capacity(capacity), _alloc(alloc) {}
+
+    ///Returnes TRUE while the elements are stored in the inline buffer
+    bool is_inline() const {
+        return(_inline!=0 && _data==_inline);
+    }
 
 public:
-    ///Creates an empty vector
-    MyVector(int s=DEFAULT_CAPACITY) : _capacity(s), _size(0) {
+    ///Creates an empty vector, no storage is allocated until the first element is inserted
+    MyVector(const Alloc& alloc=Alloc()) : _capacity(0), _size(0), _data(0), _inline(0), _inline_capacity(0), _alloc(alloc) {}
+
+    ///Creates an empty vector with room for s elements obtained from alloc
+    explicit MyVector(std::size_t s, const Alloc& alloc=Alloc()) : _capacity(0), _size(0), _data(0), _inline(0), _inline_capacity(0), _alloc(alloc) {
+        reserve(s);
+    }
+
+    ///Creates a vector holding a copy of the elements in [first,last), see assign()
+    template<class In, class = typename std::enable_if<!std::is_integral<In>::value>::type>
+    MyVector(In first, In last, const Alloc& alloc=Alloc()) : _capacity(0), _size(0), _data(0), _inline(0), _inline_capacity(0), _alloc(alloc) {
         try {
-            data = new T[_capacity];
-        } catch (const std::bad_alloc&) {}
+            assign(first,last);
+        } catch (...) {
+            clear();
+            release();
+            throw;
+        }
     }
 
-    ///Creates a list from another one using the operator=
-    MyVector(const MyVector<T>& other): _capacity(other._capacity), _size(0) {
+    ///Creates a vector from another one copying every element, the allocator is copied too
+    MyVector(const MyVector& other): _capacity(other._capacity), _size(0), _data(0), _inline(0), _inline_capacity(0), _alloc(other._alloc) {
+        _data=allocate(other._capacity);
         try {
-            data = new T[_capacity];
-        } catch (const std::bad_alloc&) {}
-        *this=other;
+            uninitialized_copy(other._data, other._data+other._size, _data);
+        } catch (...) {
+            deallocate(_data,_capacity);
+            throw;
+        }
+        _size=other._size;
+    }
+
+    ///Creates a vector stealing the heap buffer of another one, which is left empty
+    MyVector(MyVector&& other) noexcept : _capacity(0), _size(0), _data(0), _inline(0), _inline_capacity(0), _alloc(other._alloc) {
+        steal(other);
+    }
+
+    ///Creates a vector moving the content of a derived one (MySmallVector), which is left empty.
+    ///Elements kept in its inline buffer are moved into a new heap buffer, so this may throw
+    template<class V, class = typename std::enable_if<derived_rvalue<V>::value>::type>
+    MyVector(V&& other) : _capacity(0), _size(0), _data(0), _inline(0), _inline_capacity(0), _alloc(other.get_allocator()) {
+        steal(other);
     }
 
     ///Deletes a vector after clearing his content
     ~MyVector() {
-        delete[] data;
+        clear();
+        release();
     }
 
     ///Operator []
-    T& operator[](int n) {
-        return(data[n]);
+    T& operator[](std::size_t n) {
+        return(_data[n]);
+    }
+
+    ///Operator [] on a constant vector
+    const T& operator[](std::size_t n) const {
+        return(_data[n]);
     }
 
     ///Operator =
     MyVector& operator=(const MyVector& other) {
-        clear();
-        reserve(other._capacity);
+        if (this!=&other) {
+            clear();
+            reserve(other._size);
+
+            uninitialized_copy(other._data, other._data+other._size, _data);
+            _size=other._size;
+        }
+
+        return(*this);
+    }
 
-        _size=other.size();
-        for(int i=0;i<_size;++i) {
-            data[i]=other.data[i];
+    ///Operator = (move): releases the current content and steals the one of other.
+    ///It cannot fail if the allocators always compare equal, otherwise elements owned by
+    ///a different allocator are moved one by one into a new buffer
+    MyVector& operator=(MyVector&& other) noexcept(allocator_always_equal<Alloc>::value) {
+        if (this!=&other) {
+            clear();
+            steal(other);
+        }
+
+        return(*this);
+    }
+
+    ///Operator = (move) from a derived vector (MySmallVector), whose elements may be stored inline
+    template<class V, class = typename std::enable_if<derived_rvalue<V>::value>::type>
+    MyVector& operator=(V&& other) {
+        if (this!=&other) {
+            clear();
+            steal(other);
         }
 
         return(*this);
@@ -77,17 +471,39 @@ public:
     }
 
     ///Returnes the size of the vector
-    int size() const {
+    std::size_t size() const {
         return(_size);
     }
 
     ///Returnes the capacity of the vector
-    int capacity() const {
+    std::size_t capacity() const {
         return(_capacity);
     }
 
+    ///Returnes the largest number of elements a vector can hold
+    std::size_t max_size() const {
+        return(std::numeric_limits<std::size_t>::max()/sizeof(T));
+    }
+
+    ///Returnes the storage of the elements, aligned as the allocator guarantees.
+    ///The slots between size() and capacity() are raw storage
+    T* data() {
+        return(_data);
+    }
+
+    ///Returnes the storage of the elements of a constant vector
+    const T* data() const {
+        return(_data);
+    }
+
+    ///Returnes a copy of the allocator
+    Alloc get_allocator() const {
+        return(_alloc);
+    }
+
     ///Deletes the content of the vector
     void clear() {
+        destroy(_data,_data+_size);
         _size=0;
     }
 
@@ -96,7 +512,7 @@ public:
         if(_size==0) {
             throw std::out_of_range("Empty Vector");
         } else {
-            return(data[0]);
+            return(_data[0]);
         }
     }
 
@@ -105,38 +521,189 @@ public:
         if(_size==0) {
             throw std::out_of_range("Empty Vector");
         } else {
-            return(data[_size-1]);
+            return(_data[_size-1]);
+        }
+    }
+
+    ///Constructs an element at the end of the vector forwarding args to its constructor
+    template<class... Args>
+    void emplace_back(Args&&... args) {
+        if(_size==_capacity) {
+            const std::size_t new_capacity = next_capacity();
+            if (can_reallocate()) {
+                //args could refer to elements inside _data: copy the new element out before resizing
+                const T val(std::forward<Args>(args)...);
+                reallocate(new_capacity);
+                new (_data+_size) T(val);
+                ++_size;
+                return;
+            }
+            T* temp = allocate(new_capacity);
+            //args could refer to elements inside _data: build the new one before relocating
+            try {
+                new (temp+_size) T(std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(temp,new_capacity);
+                throw;
+            }
+            try {
+                relocate(temp, new_capacity);
+            } catch (...) {
+                temp[_size].~T();
+                deallocate(temp,new_capacity);
+                throw;
+            }
+        } else {
+            new (_data+_size) T(std::forward<Args>(args)...);
         }
+        ++_size;
     }
 
     ///Inserts an element at the end of the vector
     void push_back(const T& val) {
-        //in case of an empty vector
-        if (_capacity==0) reserve(DEFAULT_CAPACITY);
-        //in case of a full vector
-        else if(_size==_capacity) {
-            reserve(2*_capacity);
-        }
+        emplace_back(val);
+    }
 
-        data[_size]=val;
-        ++_size;
+    ///Inserts an element at the end of the vector moving it in place
+    void push_back(T&& val) {
+        emplace_back(std::move(val));
     }
 
-    ///Enlarges a vector to new_capacity
-    void reserve(int new_capacity) {
-        if (new_capacity>_capacity) {
+    ///Enlarges a vector to new_capacity, padded as required by the allocator alignment
+    void reserve(std::size_t new_capacity) {
+        if (new_capacity>max_size()) {
+            throw std::length_error("Vector too long");
+        }
+        new_capacity=padded(new_capacity);
+        if (new_capacity>_capacity && can_reallocate()) {
+            reallocate(new_capacity);
+        } else if (new_capacity>_capacity) {
+            T* temp = allocate(new_capacity);
             try {
-                T* temp = new T[new_capacity];
-                for(int i=0;i<_size;++i) {
-                    temp[i]=data[i];
+                relocate(temp, new_capacity);
+            } catch (...) {
+                deallocate(temp,new_capacity);
+                throw;
+            }
+        }
+    }
+
+    ///Changes the size to n deleting the last elements or appending value-initialized ones
+    void resize(std::size_t n) {
+        if (n<_size) {
+            destroy(_data+n,_data+_size);
+            _size=n;
+        } else if (n>_size) {
+            reserve(capacity_for(n-_size));
+            while (_size<n) {
+                new (_data+_size) T();
+                ++_size;
+            }
+        }
+    }
+
+    ///Changes the size to n deleting the last elements or appending copies of val
+    void resize(std::size_t n, const T& val) {
+        if (n>_capacity) {
+            //val could be an element of this vector: copy it before the storage moves
+            const T copy(val);
+            reserve(capacity_for(n-_size));
+            resize(n,copy);
+        } else if (n<_size) {
+            destroy(_data+n,_data+_size);
+            _size=n;
+        } else {
+            while (_size<n) {
+                new (_data+_size) T(val);
+                ++_size;
+            }
+        }
+    }
+
+    ///Replaces the content with a copy of the elements in [first,last), which must not belong to this vector.
+    ///Ranges that can be walked twice are measured first, so the storage is reserved once
+    template<class In>
+    void assign(In first, In last) {
+        clear();
+        append(first,last,typename std::iterator_traits<In>::iterator_category());
+    }
+
+    ///Writes the vector to out in the format of myserializer.h:
+    ///raw elements with a single write, the others as one MySerializer record each
+    void save(std::ostream& out) const {
+        mywrite_header<T>(out, _size);
+        if (MySerializer<T>::bulk) {
+            if (_size>0) {
+                out.write(reinterpret_cast<const char*>(_data), _size*sizeof(T));
+            }
+        } else {
+            for(std::size_t i=0;i<_size;++i) {
+                MySerializer<T>::write(out, _data[i]);
+            }
+        }
+        if (!out) {
+            throw std::runtime_error("Cannot save the vector");
+        }
+    }
+
+    ///Replaces the content with a vector read from in, as written by save().
+    ///The storage is reserved from the header a chunk at a time (see myload_chunk()), raw elements are read
+    ///with one read per chunk: a vector that fits a chunk is allocated and read at once.
+    ///It throws std::runtime_error on a malformed input, leaving the vector empty
+    void load(std::istream& in) {
+        clear();
+        const uint64_t count = myread_header<T>(in);
+        if (count>max_size()) {
+            throw std::runtime_error("Saved vector too long");
+        }
+        try {
+            if (MySerializer<T>::bulk) {
+                for (std::size_t left=static_cast<std::size_t>(count); left>0; ) {
+                    const std::size_t n=myload_chunk<T>(left);
+                    reserve(capacity_for(n));
+                    if (!in.read(reinterpret_cast<char*>(_data+_size), n*sizeof(T))) {
+                        throw std::runtime_error("Unexpected end of a saved container");
+                    }
+                    _size+=n;
+                    left-=n;
                 }
-                delete[] data;
-                data = temp;
-                _capacity=new_capacity;
-            } catch (const std::bad_alloc&) {}
+            } else {
+                reserve(myload_chunk<T>(count));
+                for(uint64_t i=0;i<count;++i) {
+                    emplace_back(MySerializer<T>::read(in));
+                }
+            }
+        } catch (...) {
+            clear();
+            throw;
         }
     }
 
+    ///Reduces the capacity to the size (padded) releasing the unused storage.
+    ///A vector with an inline buffer moves its elements back there when they fit
+    void shrink_to_fit() {
+        const std::size_t new_capacity=padded(_size);
+        if (new_capacity==_capacity || is_inline()) {
+            return;
+        }
+        if (_inline!=0 && _size<=_inline_capacity) {
+            relocate(_inline, _inline_capacity);
+        } else if (_size==0) {
+            release();
+            _data=0;
+            _capacity=0;
+        } else if (can_reallocate()) {
+            reallocate(new_capacity);
+        } else {
+            T* temp = allocate(new_capacity);
+            try {
+                relocate(temp, new_capacity);
+            } catch (...) {
+                deallocate(temp,new_capacity);
+                throw;
+            }
+        }
+    }
 
     ///Deletes an element at the end of the vector
     void pop_back() {
@@ -144,150 +711,372 @@ public:
             throw std::out_of_range("Empty Vector");
         } else {
             _size--;
+            _data[_size].~T();
         }
     }
 
-    ///\class iterator
-    ///\brief A forward iterator for MyVector
-    class iterator{
+    ///\class basic_iterator
+    ///\brief A random access iterator for MyVector
+    ///
+    ///iterator (U=T) and const_iterator (U=const T) are its two instances, an iterator converts to a const_iterator.
+    ///It publishes the typedefs std::iterator_traits needs, so the Standard algorithms recognize it as random access
+    template<class U>
+    class basic_iterator {
     private:
-        T* elem;
+        U* elem;
 
     public:
-        iterator() : elem(0) {}
-        ///Creates an iterator from a pointer
-        iterator(T* p) : elem(p) {}
-        ~iterator() {}
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef typename std::remove_const<U>::type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef U* pointer;
+        typedef U& reference;
 
-        ///Operator =
-        iterator& operator=(const iterator& other) {
-            elem = other.elem;
-            return(*this);
-        }
+        basic_iterator() : elem(0) {}
+        ///Creates an iterator from a pointer
+        basic_iterator(U* p) : elem(p) {}
+        ///Converts an iterator to a const_iterator
+        template<class V>
+        basic_iterator(const basic_iterator<V>& other, typename std::enable_if<std::is_convertible<V*,U*>::value>::type* =0) : elem(other.operator->()) {}
 
         ///Operator ==
-        bool operator==(const iterator& other) {
-            return(elem == other.elem);
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) {
+            return(a.elem == b.elem);
         }
 
         ///Operator !=
-        bool operator!=(const iterator& other) {
-            return(elem != other.elem);
+        friend bool operator!=(const basic_iterator& a, const basic_iterator& b) {
+            return(a.elem != b.elem);
+        }
+
+        ///Operator <
+        friend bool operator<(const basic_iterator& a, const basic_iterator& b) {
+            return(a.elem < b.elem);
+        }
+
+        ///Operator >
+        friend bool operator>(const basic_iterator& a, const basic_iterator& b) {
+            return(a.elem > b.elem);
+        }
+
+        ///Operator <=
+        friend bool operator<=(const basic_iterator& a, const basic_iterator& b) {
+            return(a.elem <= b.elem);
+        }
+
+        ///Operator >=
+        friend bool operator>=(const basic_iterator& a, const basic_iterator& b) {
+            return(a.elem >= b.elem);
         }
 
         ///Operator ++ (prefix)
-        iterator& operator++() {
+        basic_iterator& operator++() {
             ++elem;
             return(*this);
         }
 
         ///Operator ++ (postfix)
-        iterator& operator++(int) {
-            iterator& tmp(*this);
-            ++(*this);
+        basic_iterator operator++(int) {
+            basic_iterator tmp(*this);
+            ++elem;
             return(tmp);
         }
 
         ///Operator -- (prefix)
-        iterator& operator--() {
-            elem--;
+        basic_iterator& operator--() {
+            --elem;
             return(*this);
         }
 
         ///Operator -- (postfix)
-        iterator& operator--(int) {
-            iterator tmp(*this);
-            --(*this);
+        basic_iterator operator--(int) {
+            basic_iterator tmp(*this);
+            --elem;
             return(tmp);
         }
 
+        ///Operator +=
+        basic_iterator& operator+=(difference_type n) {
+            elem+=n;
+            return(*this);
+        }
+
+        ///Operator -=
+        basic_iterator& operator-=(difference_type n) {
+            elem-=n;
+            return(*this);
+        }
+
+        ///Operator +
+        friend basic_iterator operator+(basic_iterator it, difference_type n) {
+            return(it+=n);
+        }
+
+        ///Operator + (with the offset first)
+        friend basic_iterator operator+(difference_type n, basic_iterator it) {
+            return(it+=n);
+        }
+
+        ///Operator -
+        friend basic_iterator operator-(basic_iterator it, difference_type n) {
+            return(it-=n);
+        }
+
+        ///Operator -: the distance between two iterators in O(1)
+        friend difference_type operator-(const basic_iterator& a, const basic_iterator& b) {
+            return(a.elem - b.elem);
+        }
+
         ///Operator *: returns by reference
-        T& operator*() {
+        U& operator*() const {
             return(*elem);
         }
+
+        ///Operator ->
+        U* operator->() const {
+            return(elem);
+        }
+
+        ///Operator []
+        U& operator[](difference_type n) const {
+            return(elem[n]);
+        }
     };
 
-    ///\class reverse_iterator
-    ///\brief A reverse iterator for MyVector
-    class reverse_iterator{
+    ///\class basic_reverse_iterator
+    ///\brief A reverse random access iterator for MyVector
+    ///
+    ///reverse_iterator and const_reverse_iterator are its two instances.
+    ///Like std::reverse_iterator it keeps the address following the element it refers to,
+    ///so rbegin() and rend() are end() and begin() and never point outside the storage
+    template<class U>
+    class basic_reverse_iterator {
     private:
-        T* elem;
+        U* elem;
 
     public:
-        reverse_iterator() : elem(0) {}
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef typename std::remove_const<U>::type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef U* pointer;
+        typedef U& reference;
+
+        basic_reverse_iterator() : elem(0) {}
         ///Creates a reverse_iterator from a pointer to an element
-        reverse_iterator(T* p) : elem(p) {}
-        ~reverse_iterator() {}
+        basic_reverse_iterator(U* p) : elem(p+1) {}
+        ///Converts a reverse_iterator to a const_reverse_iterator
+        template<class V>
+        basic_reverse_iterator(const basic_reverse_iterator<V>& other, typename std::enable_if<std::is_convertible<V*,U*>::value>::type* =0) : elem(other.base()) {}
 
-        ///Operator =
-        reverse_iterator& operator=(const reverse_iterator& other) {
-            elem = other.elem;
-            return(*this);
+        ///Creates a reverse_iterator referring to the element before p, as std::make_reverse_iterator()
+        static basic_reverse_iterator from_base(U* p) {
+            basic_reverse_iterator it;
+            it.elem=p;
+            return(it);
+        }
+
+        ///Returnes the address following the element referred to
+        U* base() const {
+            return(elem);
         }
 
         ///Operator ==
-        bool operator==(const reverse_iterator& other) {
-            return(elem == other.elem);
+        friend bool operator==(const basic_reverse_iterator& a, const basic_reverse_iterator& b) {
+            return(a.elem == b.elem);
         }
+
         ///Operator !=
-        bool operator!=(const reverse_iterator& other) {
-            return(elem != other.elem);
+        friend bool operator!=(const basic_reverse_iterator& a, const basic_reverse_iterator& b) {
+            return(a.elem != b.elem);
+        }
+
+        ///Operator <
+        friend bool operator<(const basic_reverse_iterator& a, const basic_reverse_iterator& b) {
+            return(a.elem > b.elem);
+        }
+
+        ///Operator >
+        friend bool operator>(const basic_reverse_iterator& a, const basic_reverse_iterator& b) {
+            return(a.elem < b.elem);
+        }
+
+        ///Operator <=
+        friend bool operator<=(const basic_reverse_iterator& a, const basic_reverse_iterator& b) {
+            return(a.elem >= b.elem);
+        }
+
+        ///Operator >=
+        friend bool operator>=(const basic_reverse_iterator& a, const basic_reverse_iterator& b) {
+            return(a.elem <= b.elem);
         }
 
         ///Operator ++ (prefix)
-        reverse_iterator& operator++() {
-            if (elem != 0) {
-                --elem;
-            }
+        basic_reverse_iterator& operator++() {
+            --elem;
             return(*this);
         }
 
         ///Operator ++ (postfix)
-        reverse_iterator& operator++(int) {
-            reverse_iterator tmp(*this);
-            --(*this);
+        basic_reverse_iterator operator++(int) {
+            basic_reverse_iterator tmp(*this);
+            --elem;
             return(tmp);
         }
 
         ///Operator -- (prefix)
-        iterator& operator--() {
-            --elem;
+        basic_reverse_iterator& operator--() {
+            ++elem;
             return(*this);
         }
 
         ///Operator -- (postfix)
-        iterator& operator--(int) {
-            iterator tmp(*this);
-            ++(*this);
+        basic_reverse_iterator operator--(int) {
+            basic_reverse_iterator tmp(*this);
+            ++elem;
             return(tmp);
         }
 
+        ///Operator +=
+        basic_reverse_iterator& operator+=(difference_type n) {
+            elem-=n;
+            return(*this);
+        }
+
+        ///Operator -=
+        basic_reverse_iterator& operator-=(difference_type n) {
+            elem+=n;
+            return(*this);
+        }
+
+        ///Operator +
+        friend basic_reverse_iterator operator+(basic_reverse_iterator it, difference_type n) {
+            return(it+=n);
+        }
+
+        ///Operator + (with the offset first)
+        friend basic_reverse_iterator operator+(difference_type n, basic_reverse_iterator it) {
+            return(it+=n);
+        }
+
+        ///Operator -
+        friend basic_reverse_iterator operator-(basic_reverse_iterator it, difference_type n) {
+            return(it-=n);
+        }
+
+        ///Operator -: the distance between two reverse_iterators in O(1)
+        friend difference_type operator-(const basic_reverse_iterator& a, const basic_reverse_iterator& b) {
+            return(b.elem - a.elem);
+        }
+
         ///Operator *: returns by reference
-        T& operator*() {
-            return(*elem);
+        U& operator*() const {
+            return(*(elem-1));
+        }
+
+        ///Operator ->
+        U* operator->() const {
+            return(elem-1);
+        }
+
+        ///Operator []
+        U& operator[](difference_type n) const {
+            return(*(elem-n-1));
         }
     };
 
+    typedef basic_iterator<T> iterator;
+    typedef basic_iterator<const T> const_iterator;
+    typedef basic_reverse_iterator<T> reverse_iterator;
+    typedef basic_reverse_iterator<const T> const_reverse_iterator;
+
     ///Creates an iterator pointing to the first element of the vector
     iterator begin() {
-        return(iterator(data));
+        return(iterator(_data));
     }
 
-    ///Creates an iterator pointing after the end of the vector (0)
+    ///Creates an iterator pointing after the end of the vector
     iterator end() {
-        return(iterator(&data[_size]));
+        return(iterator(_data+_size));
+    }
+
+    ///Creates a const_iterator pointing to the first element of the vector
+    const_iterator begin() const {
+        return(const_iterator(_data));
+    }
+
+    ///Creates a const_iterator pointing after the end of the vector
+    const_iterator end() const {
+        return(const_iterator(_data+_size));
+    }
+
+    ///Creates a const_iterator pointing to the first element of the vector
+    const_iterator cbegin() const {
+        return(const_iterator(_data));
+    }
+
+    ///Creates a const_iterator pointing after the end of the vector
+    const_iterator cend() const {
+        return(const_iterator(_data+_size));
     }
 
     ///Creates a reverse_iterator pointing to the last element of the vector
     reverse_iterator rbegin() {
-        return(reverse_iterator(&data[_size-1]));
+        return(reverse_iterator::from_base(_data+_size));
     }
 
-    ///Creates a reverse_iterator pointing before the beginning of the vector (0)
+    ///Creates a reverse_iterator pointing before the beginning of the vector
     reverse_iterator rend() {
-        return(reverse_iterator(&data[-1]));
+        return(reverse_iterator::from_base(_data));
+    }
+
+    ///Creates a const_reverse_iterator pointing to the last element of the vector
+    const_reverse_iterator crbegin() const {
+        return(const_reverse_iterator::from_base(_data+_size));
+    }
+
+    ///Creates a const_reverse_iterator pointing before the beginning of the vector
+    const_reverse_iterator crend() const {
+        return(const_reverse_iterator::from_base(_data));
+    }
+
+    ///Inserts a copy of the elements in [first,last) before pos, returnes an iterator to the first one inserted.
+    ///The range must not belong to this vector. Ranges that can be walked twice are measured first,
+    ///so the storage is reserved once and the following elements are shifted as a block
+    template<class In>
+    iterator insert(const_iterator pos, In first, In last) {
+        const std::size_t index=pos-cbegin();
+        insert_range(index,first,last,typename std::iterator_traits<In>::iterator_category());
+        return(begin()+index);
+    }
+
+    ///Deletes the elements in [first,last) shifting the following ones as a block,
+    ///returnes an iterator to the element that followed the last one deleted
+    iterator erase(const_iterator first, const_iterator last) {
+        const std::size_t index=first-cbegin();
+        const std::size_t n=last-first;
+        if (n>0) {
+            T* pos=_data+index;
+            if (trivial) {
+                std::memmove(static_cast<void*>(pos), static_cast<const void*>(pos+n), (_size-index-n)*sizeof(T));
+            } else {
+                std::move(pos+n,_data+_size,pos);
+            }
+            destroy(_data+_size-n,_data+_size);
+            _size-=n;
+        }
+        return(begin()+index);
+    }
+
+    ///Deletes the element at pos, returnes an iterator to the following one
+    iterator erase(const_iterator pos) {
+        return(erase(pos,pos+1));
     }
 };
 
+///\brief A MyVector whose storage is aligned to Align bytes and whose capacity is padded to whole Align blocks,
+///so that SIMD loops can load data() with aligned instructions and run up to capacity() without a scalar tail
+template<class T, std::size_t Align, class Growth = MyDoublingGrowth>
+using MyAlignedVector = MyVector<T, MyAlignedAllocator<T,Align>, Growth>;
+
 }
 #endif